@@ -0,0 +1,1319 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Host Benchmarks
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Measures the hot path of the protocol on a Linux box: frame building, parsing,
+CRC and cipher kernels, goodput at simulated baud rates and recovery under bit
+errors and line noise, polling many slaves on a shared bus, round trip and clock offset
+estimation, forwarding between links, capture logs and their offline decoding. Usage: stardust_bench [scale]   (scale 1 = default length)
+
+*/
+
+#include "StarDustHost.h"
+#include "StarDustLogReader.h"
+#include "StarDustRouter.h"
+#include "StarDustScheduler.h"
+#include "StarDustTiming.h"
+#include "StarDustTransfer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+static double g_scale = 1.0;
+static volatile uint32_t g_sink = 0; // Derleyicinin ölçülen işi silmesini önler // Keeps the compiler from removing the measured work
+static bool g_failed = false;        // Bir bölüm "FAILED" yazdı: çıkış kodu 1 // A section printed "FAILED": exit code 1
+
+static uint32_t iterations(uint32_t base) {
+    const double n = base * g_scale;
+    return (n < 1.0) ? 1 : (uint32_t)n;
+}
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, uint32_t packets, double elapsed) {
+    printf("  %-34s %12.0f pkt/s %10.1f ns/pkt\n", name, packets / elapsed, elapsed * 1e9 / packets);
+}
+
+static TelemetryPayload sampleTelemetry(uint32_t i) {
+    TelemetryPayload tel = {1, 41.0082 + i * 1e-6, 28.9784, 120.5, 1.5f, -0.25f, i, (uint8_t)(i & 0x7F)};
+    return tel;
+}
+
+// Yazılan byte'ları yalnızca sayan port (gönderim maliyetini portsuz ölçmek için)
+// Port that only counts written bytes (to measure sending without port cost)
+class NullStream : public Stream {
+public:
+    size_t write(const uint8_t* buffer, size_t size) override { g_sink += buffer[0]; bytes += size; return size; }
+    int availableForWrite() override { return 4096; }
+    uint64_t bytes = 0;
+};
+
+// ======================== GÖNDERİM ========================
+// ======================== SENDING =========================
+static void benchSend() {
+    printf("\nSending (frame build + CRC + cipher, no port cost)\n");
+    NullStream sink;
+    StarDust node;
+    node.begin(sink, 0x01, 0x02);
+
+    const uint32_t n = iterations(1000000);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        node.sendTelemetry(1, 41.0, 29.0, 120.0 + i, 1.5f, -0.25f, i, 0);
+    }
+    report("sendTelemetry (preparePacket)", n, seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        const TelemetryPayload tel = sampleTelemetry(i);
+        node.send(tel);
+    }
+    report("send(TelemetryPayload) in place", n, seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        RequestPayload req = {1, (uint8_t)i, false};
+        node.send(req);
+    }
+    report("send(RequestPayload) 3 B", n, seconds(start));
+}
+
+// ======================== KERNELLER ========================
+// ======================== KERNELS ==========================
+static void benchKernels() {
+    printf("\nKernels (CRC mode %d, cipher mode %d)\n", STARDUST_CRC_MODE, STARDUST_CIPHER_MODE);
+    uint8_t frame[MAX_FRAME_SIZE];
+    for (size_t i = 0; i < sizeof(frame); i++) frame[i] = (uint8_t)(i * 37 + 11);
+
+    const uint32_t n = iterations(5000000);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint16_t crc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        frame[0] = (uint8_t)i;
+        crc ^= StarDustCRC::compute(frame, sizeof(PacketHeader) + PAYLOADSIZE);
+    }
+    report("CRC16 over 69 B", n, seconds(start));
+    g_sink += crc;
+
+    StarDustCipher::Schedule schedule;
+    StarDustCipher::expand(schedule, frame);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        StarDustCipher::encrypt(schedule, frame, PAYLOADSIZE);
+    }
+    report("encrypt 64 B", n, seconds(start));
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        StarDustCipher::decrypt(schedule, frame, sizeof(TelemetryPayload), (uint8_t)(i & 15));
+    }
+    report("decrypt 38 B (any offset)", n, seconds(start));
+    g_sink += frame[5];
+}
+
+// ======================== ALIM ========================
+// ======================== RECEIVING ===================
+static void fillFrames(StarDust& sender, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        const TelemetryPayload tel = sampleTelemetry(i);
+        sender.send(tel);
+    }
+}
+
+static uint32_t g_handled = 0;
+static void onTelemetry(const TelemetryPayload& tel, const PacketHeader& header, void*) {
+    g_sink += tel.status + header.source;
+    g_handled++;
+}
+
+static void benchReceive() {
+    printf("\nReceiving (parser, CRC, cipher, queue)\n");
+    const uint32_t n = iterations(200000);
+
+    LoopbackStream senderPort, receiverPort;
+    senderPort.connect(receiverPort);
+    StarDust sender, receiver;
+    sender.begin(senderPort, 0x02, 0x01);
+    receiver.begin(receiverPort, 0x01, 0x02);
+
+    // Bütçe, kuyruğu bir çağrıda taşırmayacak kadar küçük tutulur (gerçek bir UART tamponu gibi)
+    // The budget is kept small enough not to overflow the queue in one call (like a real UART buffer)
+    receiver.setByteBudget(256);
+
+    PacketData packet;
+    uint32_t received = 0;
+    fillFrames(sender, n);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (receiverPort.available() > 0) {
+        receiver.update();
+        while (receiver.pop(packet)) received++;
+    }
+    report("update() + pop(), 256 B budget", received, seconds(start));
+
+    received = 0;
+    fillFrames(sender, n);
+    start = std::chrono::steady_clock::now();
+    while (receiverPort.available() > 0) {
+        receiver.update();
+        for (const PacketData* view; (view = receiver.peek()) != nullptr; receiver.pop(packet)) {
+            g_sink += view->header.size;
+            received++;
+        }
+    }
+    report("update() + peek()", received, seconds(start));
+
+    receiver.onPacket<TELEMETRY>(onTelemetry);
+    g_handled = 0;
+    fillFrames(sender, n);
+    start = std::chrono::steady_clock::now();
+    while (receiverPort.available() > 0) {
+        receiver.dispatch();
+    }
+    report("dispatch() to typed handler", g_handled, seconds(start));
+
+    // Tek byte bütçesi: her update() çağrısı yalnızca bir byte ayrıştırır (parseByte yolu)
+    // One byte budget: every update() call parses a single byte (the parseByte path)
+    received = 0;
+    fillFrames(sender, n);
+    receiver.setByteBudget(1);
+    start = std::chrono::steady_clock::now();
+    while (receiverPort.available() > 0) {
+        if (receiver.update(packet)) received++;
+    }
+    report("update() one byte per call", received, seconds(start));
+
+#if STARDUST_FEED_BUFFER_SIZE > 0
+    // Kesme/DMA yolu: çerçeveler feed() ile blok halinde verilir
+    // Interrupt/DMA path: frames are handed over in blocks with feed()
+    // Alıcının kendi portu boş kalır, byte'lar yalnızca feed() ile gelir
+    // The receiver's own port stays idle, bytes arrive only through feed()
+    LoopbackStream idlePort;
+    StarDust fed;
+    fed.begin(idlePort, 0x01, 0x02);
+    received = 0;
+    fillFrames(sender, n);
+    uint8_t block[64];
+    start = std::chrono::steady_clock::now();
+    for (size_t length; (length = receiverPort.readBytes(block, sizeof(block))) > 0;) {
+        fed.feed(block, length);
+        fed.update();
+        while (fed.pop(packet)) received++;
+    }
+    report("feed() 64 B blocks + update()", received, seconds(start));
+#endif
+
+    printf("  dropped by a full receive queue: %u\n", (unsigned)receiver.droppedPackets());
+}
+
+// ======================== HAT VERİMİ ========================
+// ======================== LINE GOODPUT ======================
+static uint16_t frameBytes(uint8_t payloadSize) {
+#if STARDUST_VARIABLE_FRAMES
+    return sizeof(PacketHeader) + payloadSize + sizeof(uint16_t) + STARDUST_FRAMING_OVERHEAD;
+#else
+    (void)payloadSize;
+    return MAX_FRAME_SIZE;
+#endif
+}
+
+static void benchGoodput() {
+    printf("\nGoodput at simulated baud rates (8N1, 10 bits per byte, back to back frames)\n");
+    printf("  %-10s %-22s %8s %10s %12s %7s\n", "baud", "packet", "frame B", "pkt/s", "payload B/s", "eff %");
+    static const uint32_t bauds[] = {9600, 57600, 115200, 460800, 921600};
+    static const struct { const char* name; uint8_t size; } packets[] = {
+        {"REQUEST (3 B)", sizeof(RequestPayload)},
+        {"TELEMETRY (38 B)", sizeof(TelemetryPayload)},
+        {"full payload (64 B)", PAYLOADSIZE},
+    };
+    for (size_t b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++) {
+        for (size_t p = 0; p < sizeof(packets) / sizeof(packets[0]); p++) {
+            const double bytesPerSecond = bauds[b] / 10.0;
+            const double rate = bytesPerSecond / frameBytes(packets[p].size);
+            printf("  %-10u %-22s %8u %10.1f %12.1f %7.1f\n", (unsigned)bauds[b], packets[p].name, frameBytes(packets[p].size),
+                   rate, rate * packets[p].size, 100.0 * packets[p].size / frameBytes(packets[p].size));
+        }
+    }
+}
+
+// ======================== ÇERÇEVE BİRLEŞTİRME ========================
+// ======================== FRAME AGGREGATION ==========================
+#if STARDUST_AGGREGATION
+static void benchAggregation() {
+    printf("\nFrame aggregation (bursts of heartbeat + error + accept)\n");
+    printf("  %-12s %10s %10s %12s\n", "aggregation", "messages", "wire B/msg", "rx ns/msg");
+    const uint32_t bursts = iterations(50000);
+
+    for (int enabled = 0; enabled <= 1; enabled++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        // Küçük çerçeveler: bütçe alım kuyruğunu taşırmayacak kadar küçük // Small frames: the budget stays below what overflows the receive queue
+        receiver.setByteBudget(64);
+        sender.setAggregation(enabled != 0);
+
+        for (uint32_t i = 0; i < bursts; i++) {
+            sender.sendSystemHeartbeat(1, true, 0.01f, 0.02f, (uint8_t)i);
+            sender.sendError(1, (uint16_t)i, 0x10, 1);
+            sender.sendAccept(1, (uint8_t)i, true);
+            sender.flushBatch();
+        }
+        const uint64_t wire = senderPort.bytesWritten();
+
+        PacketData packet;
+        uint32_t received = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        while (receiverPort.available() > 0 || receiver.available() > 0) {
+            receiver.update();
+            while (receiver.pop(packet)) {
+                g_sink += packet.header.type;
+                received++;
+            }
+        }
+        const double elapsed = seconds(start);
+        printf("  %-12s %10u %10.1f %12.1f\n", enabled ? "on" : "off", (unsigned)received,
+               (double)wire / (3.0 * bursts), received ? elapsed * 1e9 / received : 0.0);
+    }
+}
+#endif
+
+// ======================== SIKIŞTIRILMIŞ TELEMETRİ ========================
+// ======================== COMPACT TELEMETRY ==============================
+#if STARDUST_TELEMETRY_PEERS > 0
+static void benchTelemetry() {
+    printf("\nCompact telemetry (10 Hz vehicle track, keyframe interval)\n");
+    printf("  %-12s %10s %10s %12s %12s %12s\n", "keyframes", "samples", "wire B/pkt", "ns/sample", "max lat err", "max alt err");
+    const uint32_t n = iterations(100000);
+    static const uint8_t intervals[] = {0, 10, 50};
+
+    for (size_t k = 0; k < sizeof(intervals) / sizeof(intervals[0]); k++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        sender.setTelemetryCompression(intervals[k] > 0, intervals[k]);
+
+        // ~10 m/s ileri, küçük yükseklik ve yön değişimleri // ~10 m/s ahead, small altitude and heading changes
+        TelemetryPayload tel = {1, 41.0082376, 28.9783589, 120.0, 0.5f, 0.05f, 0, 0};
+        double maxLat = 0.0, maxAlt = 0.0;
+        uint32_t received = 0;
+        PacketData packet;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < n; i++) {
+            tel.latitude += 9.13e-6;
+            tel.longitude += 3.0e-6 * ((int)(i % 7) - 3);
+            tel.altitude += 0.0213 * ((int)(i % 11) - 5);
+            tel.yaw += 0.001f;
+            tel.timestamp += 100;
+            sender.send(tel);
+            receiver.update();
+            while (receiver.pop(packet)) {
+                const TelemetryPayload decoded = receiver.receiveTelemetry(packet);
+                maxLat = std::max(maxLat, fabs(decoded.latitude - tel.latitude));
+                maxAlt = std::max(maxAlt, fabs(decoded.altitude - tel.altitude));
+                received++;
+            }
+        }
+        const double elapsed = seconds(start);
+        char name[16];
+        snprintf(name, sizeof(name), intervals[k] ? "every %u" : "off (raw)", (unsigned)intervals[k]);
+        printf("  %-12s %10u %10.1f %12.1f %12.2e %12.2e\n", name, (unsigned)received,
+               (double)senderPort.bytesWritten() / n, elapsed * 1e9 / n, maxLat, maxAlt);
+    }
+}
+#endif
+
+// ======================== HATA ENJEKSİYONU ========================
+// ======================== ERROR INJECTION =========================
+static void benchBitErrors() {
+    printf("\nBit error injection (TELEMETRY frames, goodput at 115200 baud)\n");
+    printf("  %-10s %10s %10s %12s %12s\n", "BER", "delivered", "rate %", "bad accepts", "payload B/s");
+    static const double rates[] = {0.0, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2};
+    const uint32_t n = iterations(20000);
+
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        senderPort.setBitErrorRate(rates[r], 0x5EED + (uint32_t)r);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        receiver.setByteBudget(256);
+
+        uint32_t delivered = 0, badAccepts = 0;
+        PacketData packet;
+        for (uint32_t i = 0; i < n; i++) {
+            const TelemetryPayload tel = sampleTelemetry(i);
+            sender.send(tel);
+            while (receiver.update(packet)) {
+                // CRC'yi geçen ama gönderilenle eşleşmeyen çerçeve: algılanmayan hata
+                // A frame that passes the CRC but differs from what was sent: an undetected error
+                const TelemetryPayload expected = sampleTelemetry(receiver.receiveTelemetry(packet).timestamp);
+                if (packet.header.type != TELEMETRY || memcmp(packet.payload, &expected, sizeof(expected)) != 0) badAccepts++;
+                else delivered++;
+            }
+        }
+        const double wireSeconds = senderPort.bytesWritten() * 10.0 / 115200.0;
+        printf("  %-10.0e %10u %10.2f %12u %12.1f\n", rates[r], delivered, 100.0 * delivered / n, badAccepts,
+               delivered * sizeof(TelemetryPayload) / wireSeconds);
+    }
+}
+
+static void benchNoise() {
+    printf("\nLine noise between frames (random bursts, 0xAA included)\n");
+    printf("  %-18s %10s %10s %12s\n", "burst length", "delivered", "rate %", "ns/pkt");
+    static const uint8_t bursts[] = {0, 4, 16, 64, 200};
+    const uint32_t n = iterations(20000);
+
+    for (size_t b = 0; b < sizeof(bursts); b++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        receiver.setByteBudget(256);
+
+        uint32_t seed = 0xC0FFEE;
+        uint8_t noise[256];
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t length = bursts[b] ? (uint8_t)(1 + (seed % bursts[b])) : 0;
+            for (uint8_t j = 0; j < length; j++) {
+                seed = seed * 1103515245u + 12345u;
+                noise[j] = ((seed >> 16) & 7) == 0 ? PACKET_START_BYTE : (uint8_t)(seed >> 24);
+            }
+            senderPort.inject(noise, length);
+            const TelemetryPayload tel = sampleTelemetry(i);
+            sender.send(tel);
+        }
+
+        uint32_t delivered = 0;
+        PacketData packet;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        while (receiverPort.available() > 0) {
+            receiver.update();
+            while (receiver.pop(packet)) delivered++;
+        }
+        const double elapsed = seconds(start);
+        char label[24];
+        snprintf(label, sizeof(label), bursts[b] ? "1..%u B" : "none", bursts[b]);
+        printf("  %-18s %10u %10.2f %12.1f\n", label, delivered, 100.0 * delivered / n, elapsed * 1e9 / (delivered ? delivered : 1));
+#if STARDUST_STATS
+        const StarDustStats& stats = receiver.stats();
+        printf("  %-18s CRC errors %u, malformed %u, resyncs %u, latency %u/%u/%u\n", "", (unsigned)stats.framesCrcError,
+               (unsigned)stats.framesMalformed, (unsigned)stats.resyncs, (unsigned)stats.latencyMin, (unsigned)stats.latencyAvg(), (unsigned)stats.latencyMax);
+#endif
+    }
+}
+
+// Tek byte kayıpları: hasarlı çerçeve dışında kaybolan ve geciken çerçeveler (eşleme geri kazanımı). Hat çerçeve
+// çerçeve beslenir; bir çerçeve ancak sonraki çerçevelerin byte'ları geldikten sonra teslim edilirse gecikmiştir.
+// Single byte drops: frames lost or delayed besides the damaged one (resync recovery). The line is fed frame by
+// frame; a frame is late when it is only delivered after the bytes of later frames have arrived.
+static void benchByteLoss() {
+    printf("\nSingle byte drops (TELEMETRY frames, %s framing)\n",
+           STARDUST_FRAMING == STARDUST_FRAMING_COBS ? "COBS" : "0xAA start byte");
+    printf("  %-16s %7s %10s %10s %6s %10s %6s %11s %9s\n", "drop", "drops", "delivered", "lost/drop", "late", "max delay",
+           "bad", "wire B/pkt", "ns/pkt");
+    static const uint32_t every[] = {0, 100, 10, 3};
+    const uint32_t n = iterations(20000);
+
+    for (size_t e = 0; e < sizeof(every) / sizeof(every[0]); e++) {
+        // Gönderenin portu tek başına: yazılanlar buradan geri okunur // The sender's port stands alone: what is written is read back here
+        LoopbackStream wire, line;
+        StarDust sender, receiver;
+        sender.begin(wire, 0x02, 0x01);
+        receiver.begin(line, 0x01, 0x02);
+
+        uint32_t seed = 0xD80B + (uint32_t)e;
+        uint32_t drops = 0, delivered = 0, late = 0, maxDelay = 0, bad = 0;
+        uint8_t frame[MAX_FRAME_SIZE];
+        PacketData packet;
+        double elapsed = 0.0;
+        for (uint32_t i = 0; i < n; i++) {
+            sender.send(sampleTelemetry(i));
+            size_t length = wire.readBytes(frame, sizeof(frame));
+            if (every[e] > 0 && i % every[e] == every[e] - 1) {
+                seed = seed * 1103515245u + 12345u;
+                const size_t skip = (seed >> 16) % length;
+                memmove(&frame[skip], &frame[skip + 1], length - skip - 1);
+                length--;
+                drops++;
+            }
+            line.write(frame, length);
+
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            receiver.update();
+            while (receiver.pop(packet)) {
+                // CRC'yi geçen sahte çerçeve: gönderilen hiçbir örnekle eşleşmez // A false frame that passed the CRC: matches no sample sent
+                const uint32_t sample = receiver.receiveTelemetry(packet).timestamp;
+                const TelemetryPayload expected = sampleTelemetry(sample);
+                if (sample > i || memcmp(packet.payload, &expected, sizeof(expected)) != 0) {
+                    bad++;
+                    continue;
+                }
+                if (i > sample) late++;
+                if (i - sample > maxDelay) maxDelay = i - sample;
+                delivered++;
+            }
+            elapsed += seconds(start);
+        }
+        char label[24];
+        snprintf(label, sizeof(label), every[e] ? "1 in %u frames" : "none", (unsigned)every[e]);
+        printf("  %-16s %7u %10u %10.2f %6u %10u %6u %11.1f %9.1f\n", label, (unsigned)drops, (unsigned)delivered,
+               drops ? (double)(n - delivered) / drops : 0.0, (unsigned)late, (unsigned)maxDelay, (unsigned)bad,
+               (double)wire.bytesWritten() / n, elapsed * 1e9 / n);
+    }
+}
+
+// ======================== GÜVENİLİR İLETİM ========================
+// ======================== RELIABLE DELIVERY =======================
+struct ReliableCheck {
+    uint32_t expected;
+    uint32_t delivered;
+    uint32_t gaps;
+};
+
+static void onReliable(uint8_t, PacketType, const uint8_t* data, uint8_t size, void* context) {
+    ReliableCheck* check = (ReliableCheck*)context;
+    uint32_t index;
+    memcpy(&index, data, sizeof(index));
+    if (index != check->expected || size != StarDustReliable::MAX_DATA) check->gaps++;
+    check->expected = index + 1;
+    check->delivered++;
+}
+
+static void benchReliable() {
+    printf("\nReliable delivery at 115200 baud, full duplex, window %u (simulated clock, %u B messages)\n",
+           (unsigned)STARDUST_RELIABLE_WINDOW, (unsigned)StarDustReliable::MAX_DATA);
+    printf("  %-8s %10s %10s %12s %8s %9s %10s %10s %8s\n", "loss %", "delivered", "gaps", "payload B/s", "line %", "ideal %",
+           "retransmit", "fast", "failed");
+    static const double losses[] = {0.0, 0.01, 0.02, 0.05};
+    const uint32_t n = iterations(2000);
+    const double lineBytes = 115200 / 10.0;
+    const double ideal = lineBytes * StarDustReliable::MAX_DATA / frameBytes(PAYLOADSIZE);
+
+    HostClock::setManual(true);
+    for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++) {
+        // Çerçeve kaybı oranından bit hata oranı: 1 - (1 - FER)^(1 / bit sayısı)
+        // Bit error rate from the frame loss rate: 1 - (1 - FER)^(1 / bit count)
+        const double ber = 1.0 - pow(1.0 - losses[l], 1.0 / (frameBytes(PAYLOADSIZE) * 8.0));
+        LoopbackStream portA, portB;
+        portA.connect(portB);
+        portA.setBaudRate(115200);
+        portB.setBaudRate(115200);
+        portA.setBitErrorRate(ber, 0xA11CE + (uint32_t)l);
+        portB.setBitErrorRate(ber, 0xB0B + (uint32_t)l);
+
+        StarDust nodeA, nodeB;
+        nodeA.begin(portA, 0x01, 0x02);
+        nodeB.begin(portB, 0x02, 0x01);
+        StarDustReliable sender, receiver;
+        sender.begin(nodeA);
+        receiver.begin(nodeB);
+        ReliableCheck check = {0, 0, 0};
+        receiver.onReceive(onReliable, &check);
+
+        uint8_t message[StarDustReliable::MAX_DATA];
+        memset(message, 0x5A, sizeof(message));
+        uint32_t next = 0;
+        const uint32_t startMs = millis();
+        // Gönderen penceresi izin verdikçe yazar; saat her turda 200 µs ilerler
+        // The sender writes whenever its window allows; the clock moves 200 µs per round
+        while ((check.delivered < n || !sender.idle()) && millis() - startMs < 600000) {
+            while (next < n) {
+                memcpy(message, &next, sizeof(next));
+                if (!sender.send(0x02, TELEMETRY, message, sizeof(message))) break;
+                next++;
+            }
+            sender.update();
+            receiver.update();
+            HostClock::advance(200);
+        }
+        const double elapsed = (millis() - startMs) / 1000.0;
+        const double goodput = check.delivered * StarDustReliable::MAX_DATA / elapsed;
+        const StarDustReliable::Stats& stats = sender.stats();
+        printf("  %-8.0f %10u %10u %12.1f %8.1f %9.1f %10u %10u %8u\n", losses[l] * 100.0, check.delivered, check.gaps, goodput,
+               100.0 * goodput / lineBytes, 100.0 * goodput / ideal, (unsigned)stats.retransmits, (unsigned)stats.fastRetransmits,
+               (unsigned)stats.failed);
+    }
+    HostClock::setManual(false);
+}
+
+// ======================== TOPLU AKTARIM ========================
+// ======================== BULK TRANSFER ========================
+struct TransferCheck {
+    bool done;
+    StarDustTransfer::Status status;
+};
+
+static void onTransferSent(uint8_t, uint8_t, StarDustTransfer::Status status, void* context) {
+    TransferCheck* check = (TransferCheck*)context;
+    check->done = true;
+    check->status = status;
+}
+
+static void benchTransfer() {
+    printf("\nBulk transfer of a 64 KB object at 115200 baud (simulated clock)\n");
+    printf("  %-26s %8s %10s %12s %8s\n", "mode", "loss %", "result", "payload B/s", "line %");
+    static const double losses[] = {0.0, 0.02, 0.05};
+    const uint32_t size = 65536;
+    std::vector<uint8_t> object(size), received(size);
+    for (uint32_t i = 0; i < size; i++) object[i] = (uint8_t)(i * 131 + (i >> 8));
+    const double lineBytes = 115200 / 10.0;
+
+    HostClock::setManual(true);
+    for (int mode = 0; mode < 2; mode++) {
+        for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++) {
+            const double ber = 1.0 - pow(1.0 - losses[l], 1.0 / (frameBytes(PAYLOADSIZE) * 8.0));
+            LoopbackStream portA, portB;
+            portA.connect(portB);
+            portA.setBaudRate(115200);
+            portB.setBaudRate(115200);
+            portA.setBitErrorRate(ber, 0x7A + (uint32_t)l);
+            portB.setBitErrorRate(ber, 0x7B + (uint32_t)l);
+            StarDust nodeA, nodeB;
+            nodeA.begin(portA, 0x01, 0x02);
+            nodeB.begin(portB, 0x02, 0x01);
+            StarDustReliable reliableA, reliableB;
+            reliableA.begin(nodeA);
+            reliableB.begin(nodeB);
+            StarDustTransfer sender, receiver;
+            sender.begin(reliableA);
+            receiver.begin(reliableB);
+            receiver.receiveInto(received.data(), size);
+            TransferCheck check = {false, StarDustTransfer::ABORTED};
+            sender.onSent(onTransferSent, &check);
+
+            const uint32_t startMs = millis();
+            bool ok;
+            if (mode == 0) {
+                sender.send(0x02, object.data(), size);
+                while (!check.done && millis() - startMs < 600000) {
+                    sender.update();
+                    receiver.update();
+                    HostClock::advance(200);
+                }
+                ok = check.done && check.status == StarDustTransfer::COMPLETE && received == object;
+            } else {
+                // Eski yöntem: parça gönder, onayını bekle // The old way: send a chunk, wait for its ack
+                uint32_t offset = 0;
+                while ((offset < size || !reliableA.idle()) && millis() - startMs < 600000) {
+                    if (offset < size && reliableA.idle()) {
+                        const uint8_t length = (size - offset < StarDustReliable::MAX_DATA) ? size - offset : StarDustReliable::MAX_DATA;
+                        if (reliableA.send(0x02, TELEMETRY, &object[offset], length)) offset += length;
+                    }
+                    reliableA.update();
+                    reliableB.update();
+                    HostClock::advance(200);
+                }
+                ok = offset == size && reliableA.stats().failed == 0;
+            }
+            if (!ok) g_failed = true;
+            const double elapsed = (millis() - startMs) / 1000.0;
+            printf("  %-26s %8.0f %10s %12.1f %8.1f\n", mode == 0 ? "StarDustTransfer" : "stop-and-wait chunks", losses[l] * 100.0,
+                   ok ? "ok" : "FAILED", size / elapsed, 100.0 * size / elapsed / lineBytes);
+        }
+    }
+    HostClock::setManual(false);
+}
+
+// ======================== HAT ZAMANLAYICI ========================
+// ======================== BUS SCHEDULER ==========================
+struct BusSlave {
+    BusPort port;
+    StarDust link;
+    uint32_t delay;    // Yanıttan önceki işlem süresi (µs) // Processing time before the answer (µs)
+    uint32_t replyAt;
+    uint32_t sample;
+    bool pending;
+    bool dead;
+};
+
+struct BusCount {
+    uint32_t answers;
+    uint32_t bySource[256];
+};
+
+static void onBusPoll(const RequestPayload&, const PacketHeader&, void* context) {
+    BusSlave* slave = (BusSlave*)context;
+    if (slave->dead || slave->pending) return;
+    slave->pending = true;
+    slave->replyAt = micros() + slave->delay;
+}
+
+static void onBusAnswer(const TelemetryPayload&, const PacketHeader& header, void* context) {
+    BusCount* count = (BusCount*)context;
+    count->answers++;
+    count->bySource[header.source]++;
+}
+
+enum BusMode { BUS_BROADCAST, BUS_TDMA, BUS_SCHEDULER };
+
+static void runBus(const char* label, BusMode mode, uint8_t slaves, uint8_t dead, bool fastSlave, double duration) {
+    const uint32_t baud = 115200;
+    SerialBus bus(baud);
+    BusPort masterPort;
+    bus.attach(masterPort);
+    StarDust master;
+    master.begin(masterPort, 0x00, BROADCAST_ID);
+    std::unique_ptr<BusCount> count(new BusCount());
+    memset(count.get(), 0, sizeof(BusCount));
+    master.onPacket<TELEMETRY>(onBusAnswer, count.get());
+
+    // Slave'ler 0.3-1.5 ms düşünüp yanıt verir; son 'dead' slave hiç yanıt vermez
+    // Slaves think for 0.3-1.5 ms before answering; the last 'dead' slaves never answer
+    std::unique_ptr<BusSlave[]> nodes(new BusSlave[slaves]);
+    for (uint8_t i = 0; i < slaves; i++) {
+        BusSlave& node = nodes[i];
+        bus.attach(node.port);
+        node.link.begin(node.port, i + 1, 0x00);
+        node.link.onPacket<REQUEST>(onBusPoll, &node);
+        node.delay = 300 + (i % 4) * 400;
+        node.sample = 0;
+        node.pending = false;
+        node.dead = i >= slaves - dead;
+    }
+
+    StarDustScheduler scheduler;
+    if (mode == BUS_SCHEDULER) {
+        scheduler.begin(master);
+        for (uint8_t i = 0; i < slaves; i++) {
+            if (fastSlave && i == 0) scheduler.addSlave(i + 1, 20, 1); // 50 Hz, öncelikli // 50 Hz, priority
+            else scheduler.addSlave(i + 1);
+        }
+    }
+
+    // Sabit TDMA: en yavaş slave'e göre 8 ms slot // Fixed TDMA: 8 ms slots sized for the slowest slave
+    const uint32_t tdmaSlot = 8000;
+    const RequestPayload poll = {1, 0, false};
+    uint32_t nextPoll = micros();
+    uint8_t tdmaNext = 0;
+    const uint32_t start = micros();
+    const uint32_t span = (uint32_t)(duration * 1e6);
+    while (micros() - start < span) {
+        if (mode == BUS_SCHEDULER) {
+            scheduler.update();
+        } else {
+            master.dispatch();
+            if ((int32_t)(micros() - nextPoll) >= 0) {
+                if (mode == BUS_BROADCAST) {
+                    master.sendPayload(BROADCAST_ID, REQUEST, &poll, sizeof(poll)); // Herkes aynı anda yanıtlar // Everyone answers at once
+                    nextPoll += 100000;
+                } else {
+                    master.sendPayload(tdmaNext + 1, REQUEST, &poll, sizeof(poll));
+                    tdmaNext = (tdmaNext + 1) % slaves;
+                    nextPoll += tdmaSlot;
+                }
+            }
+        }
+        for (uint8_t i = 0; i < slaves; i++) {
+            BusSlave& node = nodes[i];
+            node.link.dispatch();
+            if (node.pending && (int32_t)(micros() - node.replyAt) >= 0) {
+                const TelemetryPayload tel = sampleTelemetry(node.sample++);
+                node.link.sendPayload(0x00, TELEMETRY, &tel, sizeof(tel));
+                node.pending = false;
+            }
+        }
+        HostClock::advance(10);
+    }
+
+    // İdeal: boşluksuz yoklama + yanıt, slave düşünme süresi hariç // Ideal: back to back poll + answer, slave think time excluded
+    const double byteTime = 10.0e6 / baud;
+    const double ideal = duration * 1e6 / ((frameBytes(sizeof(RequestPayload)) + frameBytes(sizeof(TelemetryPayload))) * byteTime);
+    const uint8_t live = slaves - dead;
+    printf("  %-30s %6u %10.1f %9.1f %8.1f %10u %8.1f %9u %8.1f\n", label, (unsigned)slaves, count->answers / duration,
+           count->answers / duration / live, 100.0 * count->answers / ideal, (unsigned)bus.collisions(),
+           100.0 * bus.busyMicros() / (duration * 1e6), (unsigned)scheduler.stats().timeouts,
+           count->bySource[1] / duration);
+}
+
+static void benchScheduler() {
+    printf("\nPolling slaves on a shared 115200 baud bus (simulated clock, 45 B telemetry answers, 0.3-1.5 ms slave think time)\n");
+    printf("  %-30s %6s %10s %9s %8s %10s %8s %9s %8s\n", "master", "slaves", "answers/s", "Hz/slave", "ideal %", "collisions",
+           "busy %", "timeouts", "slave 1");
+    const double duration = 2.0 * g_scale;
+    HostClock::setManual(true);
+    runBus("broadcast poll every 100 ms", BUS_BROADCAST, 16, 0, false, duration);
+    runBus("fixed TDMA, 8 ms slots", BUS_TDMA, 16, 0, false, duration);
+    runBus("StarDustScheduler", BUS_SCHEDULER, 16, 0, false, duration);
+    runBus("StarDustScheduler", BUS_SCHEDULER, 32, 0, false, duration);
+    runBus("StarDustScheduler, 2 dead", BUS_SCHEDULER, 32, 2, false, duration);
+    runBus("StarDustScheduler, slave 1 50 Hz", BUS_SCHEDULER, 32, 0, true, duration);
+    HostClock::setManual(false);
+}
+
+// ======================== BAĞLANTI ZAMANLAMASI ========================
+// ======================== LINK TIMING =================================
+// Slave'in saati master'ınkinden sabit bir farkla ve ppm kaymasıyla ilerler
+// The slave clock runs with a fixed offset and a ppm drift against the master clock
+struct SkewedClock {
+    uint32_t base;
+    uint32_t offset;
+    double ppm;
+};
+static SkewedClock g_slaveClock;
+
+static uint32_t slaveClock() {
+    return g_slaveClock.offset + (uint32_t)((micros() - g_slaveClock.base) * (1.0 + g_slaveClock.ppm * 1e-6));
+}
+
+static uint32_t g_loopSeed = 1;
+static uint32_t loopDelay(uint32_t maxUs) {
+    g_loopSeed = g_loopSeed * 1103515245UL + 12345UL;
+    return (maxUs > 0) ? (g_loopSeed >> 8) % maxUs : 0;
+}
+
+static void runTiming(const char* label, uint32_t baud, double ppm, uint32_t maxLoop, double duration) {
+    LoopbackStream masterPort, slavePort;
+    masterPort.connect(slavePort);
+    masterPort.setBaudRate(baud);
+    slavePort.setBaudRate(baud);
+    StarDust master, slave;
+    master.begin(masterPort, 0x00, 0x01);
+    slave.begin(slavePort, 0x01, 0x00);
+
+    g_slaveClock.base = micros();
+    g_slaveClock.offset = 0x9E3779B9UL; // Saatler birbirinden bağımsız başlar // The clocks start unrelated
+    g_slaveClock.ppm = ppm;
+    g_loopSeed = 1;
+
+    StarDustTiming masterTiming, slaveTiming;
+    masterTiming.begin(master);
+    masterTiming.addPeer(0x01);
+    masterTiming.setInterval(100);
+    slaveTiming.begin(slave);
+    slaveTiming.setClock(slaveClock);
+
+    // İki döngü de her turda 0..maxLoop µs başka işle meşgul; hata ikinci yarıda her 1 ms'de ölçülür
+    // Both loops are busy with other work for 0..maxLoop µs per round; the error is measured every 1 ms in the second half
+    const uint32_t start = micros();
+    const uint32_t span = (uint32_t)(duration * 1e6);
+    uint32_t masterAt = start, slaveAt = start, checkAt = start + span / 2;
+    double errorSum = 0.0, errorMax = 0.0, plainSum = 0.0;
+    uint32_t checks = 0;
+    while (micros() - start < span) {
+        const uint32_t now = micros();
+        if ((int32_t)(now - masterAt) >= 0) {
+            masterTiming.update();
+            masterAt = now + loopDelay(maxLoop);
+        }
+        if ((int32_t)(now - slaveAt) >= 0) {
+            slaveTiming.update();
+            slaveAt = now + loopDelay(maxLoop);
+        }
+        const StarDustTiming::Estimate* estimate = masterTiming.estimate(0x01);
+        if ((int32_t)(now - checkAt) >= 0 && estimate != nullptr) {
+            const double error = fabs((double)(int32_t)(masterTiming.toPeerTime(0x01, now) - slaveClock()));
+            const double plain = fabs((double)(int32_t)(now + (uint32_t)estimate->offset - slaveClock()));
+            errorSum += error;
+            plainSum += plain;
+            if (error > errorMax) errorMax = error;
+            checks++;
+            checkAt += 1000;
+        }
+        HostClock::advance(10);
+    }
+
+    const StarDustTiming::Estimate* estimate = masterTiming.estimate(0x01);
+    if (estimate == nullptr || checks == 0) {
+        printf("  %-34s no measurement\n", label);
+        return;
+    }
+    printf("  %-34s %8u %8u %8u %8u %9.1f %9.1f %9.1f %9.1f %7u\n", label, (unsigned)estimate->rttMin, (unsigned)estimate->rttMean,
+           (unsigned)estimate->rttJitter, (unsigned)estimate->timeout, errorSum / checks, errorMax, plainSum / checks,
+           estimate->driftValid ? estimate->drift : 0.0, (unsigned)estimate->lost);
+}
+
+static void benchTiming() {
+    printf("\nRound trip and clock offset over heartbeats (simulated clock, ping every 100 ms, slave clock offset 0x9E3779B9 us)\n");
+    printf("  %-34s %8s %8s %8s %8s %9s %9s %9s %9s %7s\n", "line, slave clock, main loops", "rtt min", "rtt mean", "jitter",
+           "timeout", "err us", "err max", "no drift", "ppm est", "lost");
+    // Kayma ancak 10 s'lik aralıklarla ölçülür: kısa koşuda ikinci yarı ilk ölçümden önce başlardı
+    // The drift is only measured over 10 s spans: in a short run the second half would start before the first measurement
+    const double duration = std::max(30.0, 40.0 * g_scale);
+    HostClock::setManual(true);
+    runTiming("115200, +40 ppm, 0-0.2 ms loops", 115200, 40.0, 200, duration);
+    runTiming("115200, +3000 ppm, 0-0.2 ms loops", 115200, 3000.0, 200, duration);
+    runTiming("115200, -3000 ppm, 0-0.2 ms loops", 115200, -3000.0, 200, duration);
+    runTiming("115200, +40 ppm, 0-5 ms loops", 115200, 40.0, 5000, duration);
+    runTiming("9600, +40 ppm, 0-0.2 ms loops", 9600, 40.0, 200, duration);
+    HostClock::setManual(false);
+}
+
+#if STARDUST_ROUTING
+// ======================== YÖNLENDİRME ========================
+// ======================== ROUTING ============================
+// A (0x10) -> ara düğüm -> B (0x20). Yönlendirici iki portu bağlar; uygulama aktarması aynı işi bugünkü gibi
+// PROMISCUOUS port + pop() + sendPayload() ile yapar (çerçeve çözülür, kopyalanır, yeniden şifrelenir, kaynak kaybolur)
+// A (0x10) -> middle node -> B (0x20). The router binds two ports; the application relay does the same job the way
+// it is done today with a PROMISCUOUS port + pop() + sendPayload() (decrypted, copied, encrypted again, source lost)
+enum RouteMode { ROUTE_DIRECT, ROUTE_SAME_KEY, ROUTE_REKEY, ROUTE_RELAY };
+
+struct RouteRig {
+    LoopbackStream aPort, inPort, outPort, bPort;
+    StarDust a, in, out, b;
+    StarDustRouter router;
+    RouteMode mode;
+    uint32_t delivered;
+    uint32_t sourceKept;
+
+    RouteRig(RouteMode routeMode, uint32_t baud) : mode(routeMode), delivered(0), sourceKept(0) {
+        static const uint8_t linkKey[16] = {0x3C, 0x91, 0x5E, 0x07, 0xA2, 0x6B, 0xD4, 0x18, 0x8F, 0x20, 0x73, 0xC6, 0x4D, 0xEA, 0x39, 0xB5};
+        if (mode == ROUTE_DIRECT) {
+            aPort.connect(bPort);
+        } else {
+            aPort.connect(inPort);
+            outPort.connect(bPort);
+        }
+        if (baud > 0) {
+            aPort.setBaudRate(baud);
+            inPort.setBaudRate(baud);
+            outPort.setBaudRate(baud);
+            bPort.setBaudRate(baud);
+        }
+        a.begin(aPort, 0x10, 0x20);
+        b.begin(bPort, 0x20, 0x10);
+        in.begin(inPort, 0x01);
+        out.begin(outPort, 0x01);
+        in.setByteBudget(256);
+        b.setByteBudget(256);
+        if (mode == ROUTE_REKEY) {
+            // B tarafındaki bağlantının kendi anahtarı var // The link on the B side has a key of its own
+            out.setCryptoKey(linkKey);
+            b.setCryptoKey(linkKey);
+        }
+        if (mode == ROUTE_RELAY) {
+            in.setAddressFilter(AddressFilter::PROMISCUOUS);
+        } else {
+            router.addPort(in);
+            router.addPort(out);
+            router.addRoute(0x10, 0);
+            router.addRoute(0x20, 1);
+        }
+    }
+
+    void forward() {
+        if (mode == ROUTE_RELAY) {
+            in.update();
+            PacketData packet;
+            while (in.pop(packet)) out.sendPayload(packet.header.target, packet.header.type, packet.payload, packet.header.size);
+            out.update(); // Ters yön de dinlenir, yönlendirici de iki portu günceller // The reverse direction is served too, the router also updates both ports
+        } else if (mode != ROUTE_DIRECT) {
+            router.update();
+        }
+    }
+
+    void receive() {
+        b.update();
+        PacketData packet;
+        while (b.pop(packet)) {
+            delivered++;
+            if (packet.header.source == 0x10) sourceKept++;
+        }
+    }
+};
+
+static void runRoute(const char* name, RouteMode mode) {
+    // İş hacmi: A'nın çerçeveleri önceden yazılır ve ara düğüme feed() ile 64 byte'lık bloklar halinde verilir;
+    // Stream'in byte başına read() maliyeti ölçüme girmez, yalnızca ara düğümün işi ölçülür
+    // Throughput: A's frames are written beforehand and handed to the middle node with feed() in 64 byte blocks;
+    // the per byte read() cost of the Stream stays out, only the work of the middle node is measured
+    const uint32_t n = iterations(200000);
+    double perFrame = 0.0;
+    uint32_t delivered = 0, sourceKept = 0;
+    uint32_t rekeyed = 0;
+    for (int run = 0; run < 3 && mode != ROUTE_DIRECT; run++) { // Üç turun en iyisi // Best of three runs
+        RouteRig rig(mode, 0);
+        fillFrames(rig.a, n);
+        std::vector<uint8_t> line(rig.inPort.available());
+        rig.inPort.readBytes(line.data(), line.size());
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t offset = 0; offset < line.size(); offset += 64) {
+            rig.in.feed(line.data() + offset, std::min<size_t>(64, line.size() - offset));
+            rig.forward();
+        }
+        const double elapsed = seconds(start) * 1e9 / n;
+        if (run == 0 || elapsed < perFrame) perFrame = elapsed;
+        while (rig.bPort.available() > 0) rig.receive();
+        delivered = rig.delivered;
+        sourceKept = rig.sourceKept;
+        rekeyed = rig.router.stats().rekeyed;
+    }
+
+    // Gecikme: hatta tek çerçeve, A'nın gönderiminden B'nin pop()'una (gerçek saat, hız sınırı yok)
+    // Latency: one frame on the line, from A's send to B's pop() (real clock, no rate limit)
+    const uint32_t m = iterations(20000);
+    std::vector<double> latency;
+    latency.reserve(m);
+    {
+        RouteRig rig(mode, 0);
+        for (uint32_t i = 0; i < m; i++) {
+            const TelemetryPayload tel = sampleTelemetry(i);
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            rig.a.send(tel);
+            const uint32_t before = rig.delivered;
+            while (rig.delivered == before) {
+                rig.forward();
+                rig.receive();
+            }
+            latency.push_back(seconds(start) * 1e6);
+        }
+    }
+    std::sort(latency.begin(), latency.end());
+    double mean = 0.0;
+    for (double value : latency) mean += value;
+    mean /= latency.size();
+
+    // Hat gecikmesi 115200 baud'da (benzetilmiş saat): ara düğüm çerçevenin sonunu bekler, atlama başına bir çerçeve süresi
+    // Line latency at 115200 baud (simulated clock): the middle node waits for the end of the frame, one frame time per hop
+    HostClock::setManual(true);
+    double wire = 0.0;
+    const uint32_t frames = 50;
+    {
+        RouteRig rig(mode, 115200);
+        for (uint32_t i = 0; i < frames; i++) {
+            const TelemetryPayload tel = sampleTelemetry(i);
+            const uint32_t start = micros();
+            rig.a.send(tel);
+            const uint32_t before = rig.delivered;
+            while (rig.delivered == before && micros() - start < 1000000) {
+                rig.forward();
+                rig.receive();
+                if (rig.delivered == before) HostClock::advance(10);
+            }
+            wire += micros() - start;
+            HostClock::advance(1000); // Hat boşalır // The line drains
+        }
+    }
+    HostClock::setManual(false);
+
+    if (mode == ROUTE_DIRECT) {
+        printf("  %-30s %10s %10s %8s %9s %10.2f %10.2f %10.0f\n", name, "-", "-", "-", "-", mean, latency[latency.size() * 99 / 100],
+               wire / frames);
+    } else {
+        printf("  %-30s %10.1f %10.0f %8u %9s %10.2f %10.2f %10.0f\n", name, perFrame, 1e9 / perFrame, (unsigned)rekeyed,
+               (delivered == n) ? ((sourceKept == n) ? "all/kept" : "all/lost") : "LOSS", mean, latency[latency.size() * 99 / 100],
+               wire / frames);
+    }
+}
+
+// Üç yönlendirici üçgen oluşturur, A genel yayınları birer birer gönderir; yayma açık. Kopya süzgeci olmadan çerçeve
+// dolaşmaya devam eder.
+// Three routers form a triangle, A sends broadcasts one at a time; flooding is on. Without the duplicate filter the
+// frame keeps circulating.
+static void runLoop(uint16_t window) {
+    LoopbackStream aPort, r1a, r1b, r1c, r2a, r2b, r3a, r3b;
+    aPort.connect(r1a);
+    r1b.connect(r2a);
+    r1c.connect(r3a);
+    r2b.connect(r3b);
+    StarDust a, n1a, n1b, n1c, n2a, n2b, n3a, n3b;
+    a.begin(aPort, 0x10, BROADCAST_ID);
+    n1a.begin(r1a, 0x01);
+    n1b.begin(r1b, 0x01);
+    n1c.begin(r1c, 0x01);
+    n2a.begin(r2a, 0x02);
+    n2b.begin(r2b, 0x02);
+    n3a.begin(r3a, 0x03);
+    n3b.begin(r3b, 0x03);
+    StarDustRouter r1, r2, r3;
+    r1.addPort(n1a);
+    r1.addPort(n1b);
+    r1.addPort(n1c);
+    r2.addPort(n2a);
+    r2.addPort(n2b);
+    r3.addPort(n3a);
+    r3.addPort(n3b);
+    StarDustRouter* routers[3] = {&r1, &r2, &r3};
+    StarDust* locals[7] = {&n1a, &n1b, &n1c, &n2a, &n2b, &n3a, &n3b};
+    for (StarDustRouter* router : routers) {
+        router->setFlooding(true);
+        router->setDuplicateWindow(window);
+    }
+
+    const uint32_t broadcasts = 100;
+    const uint32_t maxRounds = 1000;
+    LoopbackStream* ports[8] = {&aPort, &r1a, &r1b, &r1c, &r2a, &r2b, &r3a, &r3b};
+    PacketData packet;
+    uint32_t sent = 0;
+    bool settled = true;
+    for (; sent < broadcasts && settled; sent++) {
+        const TelemetryPayload tel = sampleTelemetry(sent);
+        a.send(tel);
+        settled = false;
+        for (uint32_t round = 0; round < maxRounds && !settled; round++) {
+            for (StarDustRouter* router : routers) router->update();
+            for (StarDust* local : locals) {
+                while (local->pop(packet)) {}
+            }
+            settled = true;
+            for (LoopbackStream* port : ports) settled = settled && port->available() == 0;
+        }
+    }
+
+    uint32_t forwarded = 0, duplicates = 0;
+    for (StarDustRouter* router : routers) {
+        forwarded += router->stats().forwarded;
+        duplicates += router->stats().duplicates;
+    }
+    char label[40];
+    snprintf(label, sizeof(label), "duplicate window %u ms", window);
+    printf("  %-30s %10u %10u %10u %s\n", label, (unsigned)sent, (unsigned)forwarded, (unsigned)duplicates,
+           settled ? "settled" : "still circulating after 1000 rounds");
+}
+
+static void benchRouter() {
+    printf("\nForwarding A -> middle node -> B (%s framing, 45 B telemetry)\n",
+           STARDUST_FRAMING == STARDUST_FRAMING_COBS ? "COBS" : "start byte");
+    printf("  %-30s %10s %10s %8s %9s %10s %10s %10s\n", "middle node", "ns/frame", "frames/s", "rekeyed", "source", "lat us",
+           "p99 us", "115200 us");
+    runRoute("none (A and B on one link)", ROUTE_DIRECT);
+    runRoute("StarDustRouter, same key", ROUTE_SAME_KEY);
+    runRoute("StarDustRouter, other key", ROUTE_REKEY);
+    runRoute("application relay", ROUTE_RELAY);
+
+    printf("\nBroadcast flooding over a loop of three routers (up to 100 frames, one at a time)\n");
+    printf("  %-30s %10s %10s %10s\n", "", "sent", "forwarded", "duplicates");
+    runLoop(50);
+    runLoop(0);
+}
+#endif
+
+#if STARDUST_CAPTURE
+// ======================== YAKALAMA KAYDI ========================
+// ======================== CAPTURE LOG ===========================
+// Hattın ham dökümü: 8 araç yer istasyonuna telemetri gönderir, istasyon her 16 çerçevede bir bir araca COMMAND;
+// binde bir çerçevenin bir byte'ı bozulur
+// Raw dump of a line: 8 vehicles send telemetry to the ground station, the station sends a COMMAND to one vehicle
+// every 16 frames; one frame in a thousand gets a corrupted byte
+static void buildTraffic(std::vector<uint8_t>& line, uint32_t frames) {
+    LoopbackStream wire;
+    StarDust vehicles[8], ground;
+    for (uint8_t v = 0; v < 8; v++) vehicles[v].begin(wire, v + 1, 0x00);
+    ground.begin(wire, 0x00, 0x01);
+    uint8_t frame[MAX_FRAME_SIZE];
+    for (uint32_t i = 0; i < frames; i++) {
+        if (i % 16 == 15) {
+            const CommandPayload command = {1, 41.0, 29.0, 100.0f, (uint8_t)i};
+            ground.sendPayload((i / 16) % 8 + 1, COMMAND, &command, sizeof(command));
+        } else {
+            vehicles[i % 8].send(sampleTelemetry(i));
+        }
+        const size_t length = wire.readBytes(frame, sizeof(frame));
+        if (i % 1000 == 999) frame[length / 2] ^= 0x10;
+        line.insert(line.end(), frame, frame + length);
+    }
+}
+
+static void countFrame(const StarDustLogReader::Frame& frame, void*) {
+    g_sink += frame.packet.header.size;
+}
+
+static void scanRow(const char* name, StarDustLogReader& reader) {
+    // En iyi üç geçiş; dosya sayfa önbelleğinde, çözme hızı ölçülür // Best of three passes; the file is in the page cache, decoding speed is measured
+    double best = 1e30;
+    for (int pass = 0; pass < 3; pass++) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        reader.scan(&countFrame);
+        best = std::min(best, seconds(start));
+    }
+    const StarDustLogReader::Stats& stats = reader.stats();
+    printf("  %-34s %8.0f MB/s %11.0f frames/s %9llu matched %6llu crc errors\n", name, stats.bytes / best / 1e6,
+           stats.decoded / best, (unsigned long long)stats.matched, (unsigned long long)stats.crcErrors);
+}
+
+static void benchCapture() {
+    printf("\nCapture log (%s framing, 8 vehicles + ground station, 1 in 1000 frames corrupted)\n",
+           STARDUST_FRAMING == STARDUST_FRAMING_COBS ? "COBS" : "0xAA start byte");
+    const uint32_t n = iterations(1000000);
+    std::vector<uint8_t> line;
+    buildTraffic(line, n);
+
+    char logPath[] = "/tmp/stardust_capture_XXXXXX";
+    char rawPath[] = "/tmp/stardust_raw_XXXXXX";
+    const int logFd = mkstemp(logPath);
+    const int rawFd = mkstemp(rawPath);
+    if (logFd < 0 || rawFd < 0) {
+        printf("  /tmp not writable, skipped\n");
+        return;
+    }
+    ::close(logFd);
+    ::close(rawFd);
+    FileStream raw;
+    raw.open(rawPath);
+    raw.write(line.data(), line.size());
+    raw.close();
+
+    // Yer istasyonu her şeyi dinler; yakalama kapalı ve açık // The ground station hears everything; capture off and on
+    double elapsed[2];
+    uint32_t received[2];
+    uint32_t records = 0;
+    for (int capture = 0; capture < 2; capture++) {
+        LoopbackStream idle;
+        StarDust station;
+        station.begin(idle, 0x00, 0x01);
+        station.setAddressFilter(AddressFilter::PROMISCUOUS);
+        FileStream file;
+        StarDustLogWriter writer;
+        if (capture) {
+            file.open(logPath);
+            writer.begin(file);
+            writer.attach(station, 0);
+        }
+        PacketData packet;
+        received[capture] = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t pos = 0; pos < line.size(); pos += 64) {
+            station.feed(&line[pos], std::min<size_t>(64, line.size() - pos));
+            station.update();
+            while (station.pop(packet)) received[capture]++;
+        }
+        file.close();
+        elapsed[capture] = seconds(start);
+        if (capture) records = writer.records();
+    }
+    report("receive, no capture", received[0], elapsed[0]);
+    report("receive + capture to file", received[1], elapsed[1]);
+    printf("  %u records for %u frames sent\n", (unsigned)records, (unsigned)n);
+
+    StarDustLogReader reader;
+    if (!reader.open(logPath)) {
+        printf("  cannot map the log, skipped\n");
+    } else {
+        scanRow("log, every frame decoded", reader);
+        reader.matchSource(3);
+        scanRow("log, source 3", reader);
+        reader.clearMatch();
+        reader.matchType(COMMAND);
+        scanRow("log, COMMAND only", reader);
+        reader.clearMatch();
+
+        LoopbackStream idle;
+        StarDust node;
+        node.begin(idle, 0x00, 0x01);
+        node.setAddressFilter(AddressFilter::PROMISCUOUS);
+        node.onPacket<TELEMETRY>(onTelemetry);
+        g_handled = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        reader.replay(node);
+        report("replay log through dispatch()", g_handled, seconds(start));
+    }
+
+    if (!reader.open(rawPath)) {
+        printf("  cannot map the raw dump, skipped\n");
+    } else {
+        scanRow("raw dump, every frame decoded", reader);
+        reader.matchSource(3);
+        scanRow("raw dump, source 3", reader);
+        reader.clearMatch();
+    }
+    reader.close();
+    unlink(logPath);
+    unlink(rawPath);
+}
+#endif
+
+// ======================== PTY ========================
+static void benchPty() {
+    printf("\nPseudo terminal round trip (kernel tty path)\n");
+    PtyStream master, slave;
+    if (!master.openMaster() || !slave.openSlave(master.slaveName())) {
+        printf("  pty not available, skipped\n");
+        return;
+    }
+    StarDust sender, receiver;
+    sender.begin(master, 0x02, 0x01);
+    receiver.begin(slave, 0x01, 0x02);
+    receiver.setByteBudget(256);
+
+    const uint32_t n = iterations(20000);
+    uint32_t received = 0;
+    PacketData packet;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) {
+        const TelemetryPayload tel = sampleTelemetry(i);
+        sender.send(tel);
+        receiver.update();
+        while (receiver.pop(packet)) received++;
+    }
+    // Kalan byte'lar çekirdekten gelene kadar beklenir // Wait until the remaining bytes come out of the kernel
+    const uint32_t deadline = millis() + 1000;
+    while (received < n && (int32_t)(millis() - deadline) < 0) {
+        receiver.update();
+        while (receiver.pop(packet)) received++;
+    }
+    const double elapsed = seconds(start);
+    report("send + update over pty", received, elapsed);
+    printf("  delivered %u/%u, dropped by a full receive queue: %u\n", received, n, (unsigned)receiver.droppedPackets());
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) g_scale = atof(argv[1]);
+    if (g_scale <= 0.0) g_scale = 1.0;
+
+    printf("StarDust host benchmark\n");
+    printf("  variable frames %d, framing %d, RX queue %d, TX queue %d, feed buffer %d\n", STARDUST_VARIABLE_FRAMES,
+           STARDUST_FRAMING, STARDUST_RX_QUEUE_DEPTH, STARDUST_TX_QUEUE_DEPTH, STARDUST_FEED_BUFFER_SIZE);
+
+    benchSend();
+    benchKernels();
+    benchReceive();
+    benchGoodput();
+#if STARDUST_AGGREGATION
+    benchAggregation();
+#endif
+#if STARDUST_TELEMETRY_PEERS > 0
+    benchTelemetry();
+#endif
+    benchBitErrors();
+    benchNoise();
+    benchByteLoss();
+    benchReliable();
+    benchTransfer();
+    benchScheduler();
+    benchTiming();
+#if STARDUST_ROUTING
+    benchRouter();
+#endif
+#if STARDUST_CAPTURE
+    benchCapture();
+#endif
+    benchPty();
+    return g_failed ? 1 : 0;
+}
@@ -0,0 +1,937 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Regression Checks
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Pass/fail checks for the hot path, run by ctest. The CRC engines and the cipher kernels
+are compared byte for byte with plain reference code. Every packet type goes through a
+frame and back: raw payloads of several sizes, the typed sendX()/receiveX() pairs,
+aggregated and compact telemetry frames. Bit errors, line noise and dropped bytes must
+deliver exactly the frames that were not hit, and StarDustReliable and StarDustTransfer
+must deliver everything over a lossy simulated line. Prints each failure and exits with 1
+if there was any. stardust_bench keeps the numbers.
+
+*/
+
+#include "StarDustHost.h"
+#include "StarDustReliable.h"
+#include "StarDustTiming.h"
+#include "StarDustTransfer.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+static uint32_t g_checks = 0;
+static uint32_t g_failures = 0;
+
+static void expect(bool ok, const char* format, ...) {
+    g_checks++;
+    if (ok) return;
+    g_failures++;
+    va_list args;
+    va_start(args, format);
+    printf("  FAIL: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+static uint32_t g_seed = 0x5EED;
+static uint8_t randomByte() {
+    g_seed = g_seed * 1103515245u + 12345u;
+    return (uint8_t)(g_seed >> 16);
+}
+
+static void fillRandom(uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) data[i] = randomByte();
+}
+
+// ======================== REFERANS KOD ========================
+// ======================== REFERENCE CODE ======================
+static uint16_t referenceCrc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+static uint32_t referenceCrc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+    }
+    return ~crc;
+}
+
+// Byte byte şifre: c = rotl3(p) ^ rotl3(anahtar[(konum) % 16]) // Byte-wise cipher: c = rotl3(p) ^ rotl3(key[(position) % 16])
+static void referenceEncrypt(const uint8_t* key, uint8_t* data, size_t length, uint8_t offset) {
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_NONE
+    (void)key;
+    (void)data;
+    (void)length;
+    (void)offset;
+#else
+    for (size_t i = 0; i < length; i++) {
+        const uint8_t k = key[(offset + i) % StarDustCipher::KEY_SIZE];
+        data[i] = (uint8_t)(((data[i] << 3) | (data[i] >> 5)) ^ ((k << 3) | (k >> 5)));
+    }
+#endif
+}
+
+static void checkCrc() {
+    static const uint8_t digits[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    expect(StarDustCRC::compute(digits, sizeof(digits)) == 0x29B1, "CRC16 check value of \"123456789\"");
+    expect(StarDustCRC32::compute(digits, sizeof(digits)) == 0xCBF43926, "CRC32 check value of \"123456789\"");
+
+    uint8_t buffer[320];
+    fillRandom(buffer, sizeof(buffer));
+    for (size_t start = 0; start < 8; start++) {
+        for (size_t length = 0; length + start <= sizeof(buffer); length += 1 + length / 16) {
+            const uint8_t* data = buffer + start;
+            const uint16_t expected = referenceCrc16(data, length);
+            expect(StarDustCRC::compute(data, length) == expected, "CRC16 of %u bytes at +%u", (unsigned)length, (unsigned)start);
+            // Artımlı: bölünmüş tampon ve tek byte'lar aynı sonucu vermeli // Incremental: split buffer and single bytes give the same result
+            const size_t split = length / 3;
+            uint16_t crc = StarDustCRC::update(StarDustCRC::INIT, data, split);
+            crc = StarDustCRC::update(crc, data + split, length - split);
+            uint16_t bytewise = StarDustCRC::INIT;
+            for (size_t i = 0; i < length; i++) bytewise = StarDustCRC::update(bytewise, data[i]);
+            expect(crc == expected && bytewise == expected, "incremental CRC16 of %u bytes", (unsigned)length);
+            expect(StarDustCRC32::compute(data, length) == referenceCrc32(data, length), "CRC32 of %u bytes at +%u",
+                   (unsigned)length, (unsigned)start);
+        }
+    }
+}
+
+static void checkCipher() {
+    uint8_t key[StarDustCipher::KEY_SIZE];
+    fillRandom(key, sizeof(key));
+    StarDustCipher::Schedule schedule;
+    StarDustCipher::expand(schedule, key);
+
+    // Hizasız başlangıç, her anahtar konumu ve SIMD/SWAR genişliklerini aşan uzunluklar
+    // Unaligned starts, every key position and lengths across the SIMD/SWAR widths
+    uint8_t plain[80 + 8], data[80 + 8], expected[80 + 8];
+    for (uint8_t start = 0; start < 8; start++) {
+        for (uint8_t offset = 0; offset < StarDustCipher::KEY_SIZE; offset++) {
+            for (uint8_t length = 0; length <= 80; length++) {
+                fillRandom(plain, sizeof(plain));
+                memcpy(data, plain, sizeof(data));
+                memcpy(expected, plain, sizeof(expected));
+                StarDustCipher::encrypt(schedule, data + start, length, offset);
+                referenceEncrypt(key, expected + start, length, offset);
+                expect(memcmp(data, expected, sizeof(data)) == 0, "encrypt %u bytes at +%u, key offset %u", length, start, offset);
+                StarDustCipher::decrypt(schedule, data + start, length, offset);
+                expect(memcmp(data, plain, sizeof(data)) == 0, "decrypt %u bytes at +%u, key offset %u", length, start, offset);
+            }
+        }
+    }
+}
+
+// ======================== ÇERÇEVE GİDİŞ-DÖNÜŞÜ ========================
+// ======================== FRAME ROUND TRIP ============================
+struct Pair {
+    LoopbackStream senderPort, receiverPort;
+    StarDust sender, receiver;
+
+    Pair() {
+        senderPort.connect(receiverPort);
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+    }
+
+    bool next(PacketData& packet) {
+        for (int i = 0; i < 4; i++) {
+            if (receiver.update(packet)) return true;
+        }
+        return false;
+    }
+};
+
+static void checkRawTypes() {
+    static const PacketType types[] = {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
+        REQUEST,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
+        ACCEPT,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
+        REFUSE,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
+        TELEMETRY,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+        COMMAND,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+        ERROR,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
+        EMERGENCY,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
+        SYSTEMCOMMAND,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+        SYSTEMINFO,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+        SYSTEMHEARTBEAT,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
+        BETRAYAL,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE)
+        RELIABLE,
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLEACK)
+        RELIABLEACK,
+#endif
+    };
+    static const uint8_t sizes[] = {0, 1, 3, 7, 16, 38, 45, PAYLOADSIZE - 1, PAYLOADSIZE};
+
+    Pair pair;
+    uint8_t payload[PAYLOADSIZE];
+    PacketData packet;
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+        for (size_t s = 0; s < sizeof(sizes); s++) {
+            const uint8_t size = sizes[s] <= PAYLOADSIZE ? sizes[s] : PAYLOADSIZE;
+            fillRandom(payload, sizeof(payload));
+            // Başlangıç byte'ı ve COBS ayracı payload içinde de görünmeli // The start byte and the COBS delimiter must also show up inside the payload
+            if (size > 2) {
+                payload[0] = PACKET_START_BYTE;
+                payload[size - 1] = 0x00;
+            }
+            expect(pair.sender.sendPayload(types[t], payload, size), "sendPayload type %u, %u bytes", types[t], size);
+            const bool received = pair.next(packet);
+            expect(received && packet.header.type == types[t] && packet.header.size == size && packet.header.source == 0x02 &&
+                       packet.header.target == 0x01 && memcmp(packet.payload, payload, size) == 0,
+                   "round trip of type %u, %u bytes", types[t], size);
+        }
+    }
+}
+
+template<typename Payload>
+static void expectPayload(Pair& pair, PacketType type, const Payload& expected, Payload (StarDustCore::*receive)(const PacketData&)) {
+    PacketData packet;
+    const bool received = pair.next(packet);
+    const Payload got = received ? (pair.receiver.*receive)(packet) : Payload();
+    expect(received && packet.header.type == type && packet.header.size == sizeof(Payload) && memcmp(&got, &expected, sizeof(got)) == 0,
+           "sendX/receiveX round trip of type %u", type);
+}
+
+static void checkTypedHelpers() {
+    Pair pair;
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
+    pair.sender.sendRequest(1, 2, true);
+    expectPayload(pair, REQUEST, RequestPayload{1, 2, true}, &StarDustCore::receiveRequest);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
+    pair.sender.sendAccept(1, 3, true);
+    expectPayload(pair, ACCEPT, AcceptPayload{1, 3, true}, &StarDustCore::receiveAccept);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
+    pair.sender.sendRefuse(1, 4, false);
+    expectPayload(pair, REFUSE, RefusePayload{1, 4, false}, &StarDustCore::receiveRefuse);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
+    pair.sender.sendTelemetry(1, 41.0082, 28.9784, 120.5, 1.5f, -0.25f, 123456, 0xAA);
+    expectPayload(pair, TELEMETRY, TelemetryPayload{1, 41.0082, 28.9784, 120.5, 1.5f, -0.25f, 123456, 0xAA},
+                  &StarDustCore::receiveTelemetry);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+    pair.sender.sendCommand(1, 41.0, 29.0, 120.0f, 0x01);
+    expectPayload(pair, COMMAND, CommandPayload{1, 41.0, 29.0, 120.0f, 0x01}, &StarDustCore::receiveCommand);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+    pair.sender.sendError(1, 0x1234, 0xAA00, 3);
+    expectPayload(pair, ERROR, ErrorPayload{1, 0x1234, 0xAA00, 3}, &StarDustCore::receiveError);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
+    pair.sender.sendEmergency(1, 0x0BAD, 0x00AA, 9);
+    expectPayload(pair, EMERGENCY, EmergencyPayload{1, 0x0BAD, 0x00AA, 9}, &StarDustCore::receiveEmergency);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
+    pair.sender.sendSystemCommand(1, 0x0102, 0x0304, 0x02, 7);
+    expectPayload(pair, SYSTEMCOMMAND, SystemCommandPayload{1, 0x0102, 0x0304, 0x02, 7}, &StarDustCore::receiveSystemCommand);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+    pair.sender.sendSystemInfo(1, 2, true, 0.5f, 36.6f, 3.3f, 86400, 0.01f, 0.02f, 0.99f);
+    expectPayload(pair, SYSTEMINFO, SystemInfoPayload{1, 2, true, 0.5f, 36.6f, 3.3f, 86400, 0.01f, 0.02f, 0.99f},
+                  &StarDustCore::receiveSystemInfo);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+    pair.sender.sendSystemHeartbeat(1, true, 0.01f, 0.02f, 4);
+    expectPayload(pair, SYSTEMHEARTBEAT, SystemHeartbeatPayload{1, true, 0.01f, 0.02f, 4}, &StarDustCore::receiveSystemHeartbeat);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
+    pair.sender.sendBetrayal(1, true, 0x0666, 0x0013, 5, true, false, true, false, 0.7f, 0.2f, true, 3, 0.9f, false);
+    expectPayload(pair, BETRAYAL, BetrayalPayload{1, true, 0x0666, 0x0013, 5, true, false, true, false, 0.7f, 0.2f, true, 3, 0.9f, false},
+                  &StarDustCore::receiveBetrayal);
+#endif
+}
+
+#if STARDUST_AGGREGATION && STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST) && STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+static void checkAggregation() {
+    Pair pair;
+    pair.sender.setAggregation(true);
+    const RequestPayload request = {1, 2, true};
+    const ErrorPayload error = {1, 0x1234, 0x5678, 2};
+    pair.sender.send(request);
+    pair.sender.send(error);
+    pair.sender.send(request);
+    expect(pair.sender.flushBatch(), "flushBatch() with three messages");
+    PacketData packet;
+    const bool first = pair.next(packet) && packet.header.type == REQUEST && memcmp(packet.payload, &request, sizeof(request)) == 0;
+    const bool second = pair.next(packet) && packet.header.type == ERROR && memcmp(packet.payload, &error, sizeof(error)) == 0;
+    const bool third = pair.next(packet) && packet.header.type == REQUEST && memcmp(packet.payload, &request, sizeof(request)) == 0;
+    expect(first && second && third && !pair.next(packet), "AGGREGATE frame split into its three messages in order");
+}
+#endif
+
+#if STARDUST_TELEMETRY_PEERS > 0
+static void checkCompactTelemetry() {
+    Pair pair;
+    pair.sender.setTelemetryCompression(true, 4);
+    PacketData packet;
+    for (uint32_t i = 0; i < 20; i++) {
+        const TelemetryPayload sent = {1, 41.0082 + i * 1e-5, 28.9784 - i * 1e-5, 120.5 + i * 0.25, 1.5f + i, -0.25f, 1000 + i * 20,
+                                       (uint8_t)i};
+        pair.sender.send(sent);
+        const bool received = pair.next(packet) && packet.header.type == TELEMETRY;
+        const TelemetryPayload got = received ? pair.receiver.receiveTelemetry(packet) : TelemetryPayload();
+        // Farklar sabit noktada yuvarlanır: konum 1e-6 derece, irtifa ve açılar santim/yüzde bir derece mertebesinde
+        // Deltas are rounded in fixed point: position to 1e-6 degrees, altitude and angles to about a centimetre / a hundredth of a degree
+        expect(received && got.version == sent.version && got.timestamp == sent.timestamp && got.status == sent.status &&
+                   fabs(got.latitude - sent.latitude) < 1e-6 && fabs(got.longitude - sent.longitude) < 1e-6 &&
+                   fabs(got.altitude - sent.altitude) < 0.01 && fabs(got.yaw - sent.yaw) < 0.01f && fabs(got.pitch - sent.pitch) < 0.01f,
+               "compact telemetry sample %u", (unsigned)i);
+    }
+}
+#endif
+
+// ======================== HATA ENJEKSİYONU ========================
+// ======================== ERROR INJECTION =========================
+static TelemetryPayload sampleTelemetry(uint32_t i) {
+    TelemetryPayload tel = {1, 41.0082 + i * 1e-6, 28.9784, 120.5, 1.5f, -0.25f, i, (uint8_t)(i & 0x7F)};
+    return tel;
+}
+
+// Bit hataları: bit çevrilmeyen her çerçeve teslim edilmeli, bozuk çerçeve kabul edilmemeli. COBS'ta çerçeveler
+// arasındaki ayraçta çevrilen bit çerçeveye dokunmaz, o çerçeve de gelebilir.
+// Bit errors: every frame without a flipped bit must be delivered, no damaged frame may be accepted. With COBS a bit
+// flipped in the delimiter between frames does not touch the frame, so that frame may arrive too.
+static void checkBitErrors() {
+    static const double rates[] = {0.0, 1e-5, 1e-4, 1e-3};
+    const uint32_t n = 5000;
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        senderPort.setBitErrorRate(rates[r], 0x5EED + (uint32_t)r);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        receiver.setByteBudget(256);
+
+        std::vector<bool> clean(n, false), delivered(n, false);
+        uint32_t bad = 0;
+        PacketData packet;
+        for (uint32_t i = 0; i <= n; i++) {
+            if (i < n) {
+                const uint64_t flipped = senderPort.bitsFlipped();
+                sender.send(sampleTelemetry(i));
+                clean[i] = senderPort.bitsFlipped() == flipped;
+            }
+            while (receiver.update(packet)) {
+                const uint32_t sample = receiver.receiveTelemetry(packet).timestamp;
+                const TelemetryPayload expected = sampleTelemetry(sample);
+                if (packet.header.type != TELEMETRY || sample >= n || memcmp(packet.payload, &expected, sizeof(expected)) != 0) bad++;
+                else delivered[sample] = true;
+            }
+        }
+        uint32_t cleanFrames = 0, missing = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            if (!clean[i]) continue;
+            cleanFrames++;
+            if (!delivered[i]) missing++;
+        }
+        expect(missing == 0 && bad == 0, "bit error rate %g: %u of %u clean frames missing, %u bad accepts", rates[r],
+               (unsigned)missing, (unsigned)cleanFrames, (unsigned)bad);
+    }
+}
+
+static void checkNoise() {
+    static const uint8_t bursts[] = {4, 64, 200};
+    const uint32_t n = 5000;
+    for (size_t b = 0; b < sizeof(bursts); b++) {
+        LoopbackStream senderPort, receiverPort;
+        senderPort.connect(receiverPort);
+        StarDust sender, receiver;
+        sender.begin(senderPort, 0x02, 0x01);
+        receiver.begin(receiverPort, 0x01, 0x02);
+        receiver.setByteBudget(256);
+
+        uint32_t seed = 0xC0FFEE;
+        uint8_t noise[256];
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t length = (uint8_t)(1 + (seed % bursts[b]));
+            for (uint8_t j = 0; j < length; j++) {
+                seed = seed * 1103515245u + 12345u;
+                noise[j] = ((seed >> 16) & 7) == 0 ? PACKET_START_BYTE : (uint8_t)(seed >> 24);
+            }
+            senderPort.inject(noise, length);
+            sender.send(sampleTelemetry(i));
+        }
+
+        uint32_t delivered = 0, inOrder = 0;
+        PacketData packet;
+        while (receiverPort.available() > 0 || receiver.peek() != nullptr) {
+            receiver.update();
+            while (receiver.pop(packet)) {
+                if (receiver.receiveTelemetry(packet).timestamp == delivered) inOrder++;
+                delivered++;
+            }
+        }
+        expect(delivered == n && inOrder == n, "noise bursts of 1..%u B: %u of %u frames delivered in order", bursts[b],
+               (unsigned)inOrder, (unsigned)n);
+    }
+}
+
+// Tek byte kaybı yalnızca hasarlı çerçeveyi götürmeli // A single dropped byte must only cost the damaged frame
+static void checkByteLoss() {
+    static const uint32_t every[] = {100, 10};
+    const uint32_t n = 5000;
+    for (size_t e = 0; e < sizeof(every) / sizeof(every[0]); e++) {
+        LoopbackStream wire, line;
+        StarDust sender, receiver;
+        sender.begin(wire, 0x02, 0x01);
+        receiver.begin(line, 0x01, 0x02);
+
+        uint32_t seed = 0xD80B + (uint32_t)e;
+        uint32_t drops = 0, delivered = 0, bad = 0;
+        uint8_t frame[MAX_FRAME_SIZE];
+        PacketData packet;
+        for (uint32_t i = 0; i < n; i++) {
+            sender.send(sampleTelemetry(i));
+            size_t length = wire.readBytes(frame, sizeof(frame));
+            if (i % every[e] == every[e] - 1) {
+                seed = seed * 1103515245u + 12345u;
+                const size_t skip = (seed >> 16) % length;
+                memmove(&frame[skip], &frame[skip + 1], length - skip - 1);
+                length--;
+                drops++;
+            }
+            line.write(frame, length);
+            receiver.update();
+            while (receiver.pop(packet)) {
+                const uint32_t sample = receiver.receiveTelemetry(packet).timestamp;
+                const TelemetryPayload expected = sampleTelemetry(sample);
+                if (sample > i || memcmp(packet.payload, &expected, sizeof(expected)) != 0) bad++;
+                else delivered++;
+            }
+        }
+        expect(delivered == n - drops && bad == 0, "one byte dropped in 1 of %u frames: %u of %u delivered, %u bad accepts",
+               (unsigned)every[e], (unsigned)delivered, (unsigned)(n - drops), (unsigned)bad);
+    }
+}
+
+// ======================== GÜVENİLİR TESLİM ========================
+// ======================== RELIABLE DELIVERY =======================
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+// Çerçeve kaybı oranından bit hata oranı // Bit error rate from the frame loss rate
+static double bitErrorRate(double frameLoss) {
+    return 1.0 - pow(1.0 - frameLoss, 1.0 / (MAX_FRAME_SIZE * 8.0));
+}
+
+struct ReliableCount {
+    uint32_t expected;
+    uint32_t delivered;
+    uint32_t gaps;
+};
+
+static void onReliable(uint8_t, PacketType, const uint8_t* data, uint8_t size, void* context) {
+    ReliableCount* count = (ReliableCount*)context;
+    uint32_t index;
+    memcpy(&index, data, sizeof(index));
+    if (index != count->expected || size != StarDustReliable::MAX_DATA) count->gaps++;
+    count->expected = index + 1;
+    count->delivered++;
+}
+
+static void checkReliable() {
+    static const double losses[] = {0.0, 0.05};
+    const uint32_t n = 500;
+    for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++) {
+        LoopbackStream portA, portB;
+        portA.connect(portB);
+        portA.setBaudRate(115200);
+        portB.setBaudRate(115200);
+        portA.setBitErrorRate(bitErrorRate(losses[l]), 0xA11CE + (uint32_t)l);
+        portB.setBitErrorRate(bitErrorRate(losses[l]), 0xB0B + (uint32_t)l);
+        StarDust nodeA, nodeB;
+        nodeA.begin(portA, 0x01, 0x02);
+        nodeB.begin(portB, 0x02, 0x01);
+        StarDustReliable sender, receiver;
+        sender.begin(nodeA);
+        receiver.begin(nodeB);
+        ReliableCount count = {0, 0, 0};
+        receiver.onReceive(onReliable, &count);
+
+        uint8_t message[StarDustReliable::MAX_DATA];
+        memset(message, 0x5A, sizeof(message));
+        uint32_t next = 0;
+        const uint32_t startMs = millis();
+        while ((count.delivered < n || !sender.idle()) && millis() - startMs < 600000) {
+            while (next < n) {
+                memcpy(message, &next, sizeof(next));
+                if (!sender.send(0x02, TELEMETRY, message, sizeof(message))) break;
+                next++;
+            }
+            sender.update();
+            receiver.update();
+            HostClock::advance(200);
+        }
+        expect(count.delivered == n && count.gaps == 0 && sender.stats().failed == 0,
+               "StarDustReliable at %.0f %% loss: %u of %u delivered, %u gaps, %u failed", losses[l] * 100.0,
+               (unsigned)count.delivered, (unsigned)n, (unsigned)count.gaps, (unsigned)sender.stats().failed);
+    }
+}
+
+struct TransferResult {
+    bool done;
+    StarDustTransfer::Status status;
+};
+
+static void onTransferSent(uint8_t, uint8_t, StarDustTransfer::Status status, void* context) {
+    TransferResult* result = (TransferResult*)context;
+    result->done = true;
+    result->status = status;
+}
+
+static void checkTransfer() {
+    static const double losses[] = {0.0, 0.02, 0.05};
+    const uint32_t size = 65536;
+    std::vector<uint8_t> object(size), received(size);
+    for (uint32_t i = 0; i < size; i++) object[i] = (uint8_t)(i * 131 + (i >> 8));
+
+    for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++) {
+        LoopbackStream portA, portB;
+        portA.connect(portB);
+        portA.setBaudRate(115200);
+        portB.setBaudRate(115200);
+        portA.setBitErrorRate(bitErrorRate(losses[l]), 0x7A + (uint32_t)l);
+        portB.setBitErrorRate(bitErrorRate(losses[l]), 0x7B + (uint32_t)l);
+        StarDust nodeA, nodeB;
+        nodeA.begin(portA, 0x01, 0x02);
+        nodeB.begin(portB, 0x02, 0x01);
+        StarDustReliable reliableA, reliableB;
+        reliableA.begin(nodeA);
+        reliableB.begin(nodeB);
+        StarDustTransfer sender, receiver;
+        sender.begin(reliableA);
+        receiver.begin(reliableB);
+        std::fill(received.begin(), received.end(), 0);
+        receiver.receiveInto(received.data(), size);
+        TransferResult result = {false, StarDustTransfer::ABORTED};
+        sender.onSent(onTransferSent, &result);
+
+        sender.send(0x02, object.data(), size);
+        const uint32_t startMs = millis();
+        while (!result.done && millis() - startMs < 600000) {
+            sender.update();
+            receiver.update();
+            HostClock::advance(200);
+        }
+        expect(result.done && result.status == StarDustTransfer::COMPLETE && received == object,
+               "StarDustTransfer of 64 KB at %.0f %% loss", losses[l] * 100.0);
+    }
+}
+#endif
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+// Adres süzgeci: bizim ID'miz, yabancı ID, katılınan ve katılınmayan grup, yayın araya karışık gönderilir.
+// Atlanan her çerçeveden sonraki çerçeve eksiksiz gelmelidir (atlama uzunluğunda bir byte hata onu yutar).
+// Address filter: our ID, a foreign ID, a joined and a non-joined group and broadcast are interleaved.
+// The frame after every skipped one must arrive intact (a skip length off by one byte would swallow it).
+static void checkAddressFilter() {
+    static const uint8_t targets[] = {0x01, 0x05, 0x40, 0x41, BROADCAST_ID, 0x05, 0x41, 0x01, 0x40};
+    static const AddressFilter modes[] = {AddressFilter::VALIDATE, AddressFilter::EARLY, AddressFilter::PROMISCUOUS};
+    static const char* const names[] = {"VALIDATE", "EARLY", "PROMISCUOUS"};
+    const uint8_t frames = 4 * sizeof(targets);
+
+    for (uint8_t m = 0; m < 3; m++) {
+        for (uint16_t budget = 0; budget <= 1; budget++) {
+            Pair pair;
+            pair.receiver.setAddressFilter(modes[m]);
+            pair.receiver.acceptAddress(0x40);
+            pair.receiver.setByteBudget(budget);
+
+            std::vector<uint8_t> expected, arrived;
+            bool intact = true;
+            for (uint8_t i = 0; i < frames; i++) {
+                const uint8_t target = targets[i % sizeof(targets)];
+                const bool wanted = modes[m] == AddressFilter::PROMISCUOUS || target == 0x01 || target == 0x40 || target == BROADCAST_ID;
+                if (wanted) expected.push_back(i);
+
+                // Sıra numarası, start byte'ı ve sıfırlar: yeniden tarama ve COBS için zor payload
+                // Sequence number, start bytes and zeros: a hard payload for rescanning and COBS
+                uint8_t payload[PAYLOADSIZE];
+                const uint8_t size = 1 + (i * 7) % PAYLOADSIZE;
+                for (uint8_t k = 0; k < size; k++) payload[k] = (k % 3 == 0) ? PACKET_START_BYTE : (k % 3 == 1) ? 0x00 : (uint8_t)(i + k);
+                payload[0] = i;
+                pair.sender.sendPayload(target, COMMAND, payload, size);
+
+                // Kuyruk taşmasın diye dörder çerçevede bir boşaltılır // Drained every four frames so the queue never overflows
+                if (i % 4 != 3 && i + 1 != frames) continue;
+                for (int spin = 0; spin < 4096; spin++) {
+                    pair.receiver.update();
+                    PacketData packet;
+                    while (pair.receiver.pop(packet)) {
+                        const uint8_t seq = packet.payload[0];
+                        const uint8_t want = 1 + (seq * 7) % PAYLOADSIZE;
+                        const uint8_t wantTarget = targets[seq % sizeof(targets)];
+                        bool same = packet.header.type == COMMAND && packet.header.size == want && packet.header.target == wantTarget;
+                        for (uint8_t k = 1; k < want && same; k++) {
+                            same = packet.payload[k] == ((k % 3 == 0) ? PACKET_START_BYTE : (k % 3 == 1) ? 0x00 : (uint8_t)(seq + k));
+                        }
+                        intact = intact && same;
+                        arrived.push_back(seq);
+                    }
+                }
+            }
+            expect(arrived == expected && intact, "%s filter%s: %u of %u frames, expected %u", names[m],
+                   budget ? " byte by byte" : "", (unsigned)arrived.size(), (unsigned)frames, (unsigned)expected.size());
+        }
+    }
+}
+#endif
+
+#if STARDUST_TX_QUEUE_DEPTH > 0 && \
+    STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY | STARDUST_TYPE_EMERGENCY | STARDUST_TYPE_ERROR | STARDUST_TYPE_SYSTEMCOMMAND)
+// Öncelikli şerit: kısılmış portta TELEMETRY arkasında bekleyen EMERGENCY/ERROR/SYSTEMCOMMAND, yazılmakta olan
+// çerçeve bittikten hemen sonra gider
+// Priority lane: on a throttled port, EMERGENCY/ERROR/SYSTEMCOMMAND waiting behind TELEMETRY leave right after
+// the frame being written is finished
+static void checkTxPriority() {
+    const uint8_t telemetry = STARDUST_TX_QUEUE_DEPTH - 1;
+    Pair pair;
+    // Her gönderim en çok 2 byte yazar: ilk çerçeve tüm gönderimler boyunca yarım kalır
+    // Every send writes at most 2 bytes: the first frame stays half written through all the sends
+    pair.senderPort.setWriteWindow(2);
+    for (uint8_t i = 0; i < telemetry; i++) {
+        const TelemetryPayload tel = {i, 41.0 + i, 29.0, 100.0, 1.0f, 2.0f, i, i};
+        expect(pair.sender.send(tel), "TELEMETRY %u queued", (unsigned)i);
+    }
+    const EmergencyPayload emergency = {1, 0x0BAD, 0x00AA, 9};
+    const ErrorPayload error = {1, 0x1234, 0x5678, 2};
+    const SystemCommandPayload command = {1, 0x0042, 0x0007, 0x02, 3};
+    expect(pair.sender.send(emergency) && pair.sender.send(error) && pair.sender.send(command), "priority frames queued");
+    expect(pair.sender.txHighWater() == telemetry + 3, "txHighWater() %u, expected %u", (unsigned)pair.sender.txHighWater(),
+           (unsigned)(telemetry + 3));
+
+    // Port açılır, kuyruk boşalır // The port opens up, the queue drains
+    pair.senderPort.setWriteWindow(0);
+    for (int i = 0; i < 4 && pair.sender.flushTx() > 0; i++) {}
+    expect(pair.sender.txQueued() == 0, "transmit queue drained");
+
+    pair.receiver.setByteBudget(64); // Alım kuyruğu taşmasın // Keep the receive queue from overflowing
+    std::vector<PacketType> order;
+    std::vector<uint8_t> telemetrySeq;
+    PacketData packet;
+    while (pair.next(packet)) {
+        order.push_back(packet.header.type);
+        if (packet.header.type == TELEMETRY) telemetrySeq.push_back(pair.receiver.receiveTelemetry(packet).version);
+    }
+    std::vector<PacketType> expected = {TELEMETRY, EMERGENCY, ERROR, SYSTEMCOMMAND};
+    std::vector<uint8_t> expectedSeq;
+    for (uint8_t i = 0; i < telemetry; i++) {
+        if (i > 0) expected.push_back(TELEMETRY);
+        expectedSeq.push_back(i);
+    }
+    expect(order == expected && telemetrySeq == expectedSeq,
+           "frame in progress finished first, then EMERGENCY, ERROR, SYSTEMCOMMAND, then the rest of TELEMETRY in order");
+
+    // Şerit dolu: fazlası reddedilir ve sayılır, öncelikli şerit etkilenmez
+    // Lane full: the excess is refused and counted, the priority lane is not affected
+    pair.senderPort.setWriteWindow(1);
+    uint32_t refused = 0;
+    for (uint8_t i = 0; i < STARDUST_TX_QUEUE_DEPTH + 3; i++) {
+        const TelemetryPayload tel = {i, 0.0, 0.0, 0.0, 0.0f, 0.0f, i, i};
+        if (!pair.sender.send(tel)) refused++;
+    }
+    expect(refused == 3 && pair.sender.txDropped() == 3, "full lane: %u refused, txDropped() %u, expected 3", (unsigned)refused,
+           (unsigned)pair.sender.txDropped());
+    expect(pair.sender.send(emergency) && pair.sender.txDropped() == 3, "EMERGENCY still queued with the normal lane full");
+}
+#endif
+
+#if STARDUST_VARIABLE_FRAMES && STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST) && STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+// Örnek başına ayarlar: kısa payload'lı ve şifresiz bağlantı // Per-instance settings: a short-payload, unencrypted link
+static void countRequest(const RequestPayload& request, const PacketHeader&, void* context) {
+    if (request.requestType == 7) (*(uint32_t*)context)++;
+}
+
+static void checkInstanceSettings() {
+    typedef StarDustT<16, false> SmallLink;
+    expect(sizeof(SmallLink) < sizeof(StarDust), "StarDustT<16, false> is smaller than StarDust (%u < %u bytes)",
+           (unsigned)sizeof(SmallLink), (unsigned)sizeof(StarDust));
+
+    LoopbackStream senderPort, receiverPort;
+    senderPort.connect(receiverPort);
+    SmallLink sender, receiver;
+    sender.begin(senderPort, 0x02, 0x01);
+    receiver.begin(receiverPort, 0x01, 0x02);
+    expect(receiver.maxPayload() == 16, "maxPayload() of StarDustT<16>");
+
+    uint8_t data[PAYLOADSIZE];
+    for (uint8_t i = 0; i < sizeof(data); i++) data[i] = randomByte();
+    PacketData packet;
+    expect(!sender.sendPayload(COMMAND, data, 17), "sendPayload() longer than MaxPayload is refused");
+    expect(sender.sendPayload(COMMAND, data, 16), "sendPayload() of MaxPayload bytes");
+    bool received = false;
+    for (int i = 0; i < 4 && !received; i++) received = receiver.update(packet);
+    bool tailClear = true;
+    for (uint8_t i = 16; i < PAYLOADSIZE; i++) tailClear = tailClear && packet.payload[i] == 0;
+    expect(received && packet.header.size == 16 && memcmp(packet.payload, data, 16) == 0 && tailClear,
+           "16-byte payload round trip, pop() clears the rest of PacketData");
+
+    // Uzun çerçeve bozuk başlık sayılır, arkasındaki kısa çerçeve yine alınır
+    // A longer frame counts as a malformed header, the short frame behind it still arrives
+    LoopbackStream widePort;
+    widePort.connect(receiverPort);
+    StarDustT<PAYLOADSIZE, false> wide;
+    wide.begin(widePort, 0x02, 0x01);
+    wide.sendPayload(COMMAND, data, 20);
+    wide.sendPayload(COMMAND, data, 5);
+    received = false;
+    for (int i = 0; i < 4 && !received; i++) received = receiver.update(packet);
+    expect(received && packet.header.size == 5 && memcmp(packet.payload, data, 5) == 0 && receiver.available() == 0,
+           "frame longer than MaxPayload rejected, the next one received");
+
+    // Kısa yuvadan dağıtım // Dispatch from a short slot
+    uint32_t requests = 0;
+    receiver.onPacket<REQUEST>(countRequest, &requests);
+    sender.sendRequest(1, 7, true);
+    for (int i = 0; i < 4; i++) receiver.dispatch();
+    expect(requests == 1, "typed handler on StarDustT<16, false>");
+
+#if STARDUST_FRAMING == STARDUST_FRAMING_START_BYTE
+    // Şifresiz örnek payload'ı hatta olduğu gibi gönderir // An unencrypted instance puts the payload on the wire as it is
+    LoopbackStream plainPort, tapPort;
+    plainPort.connect(tapPort);
+    StarDustT<PAYLOADSIZE, false> plain;
+    plain.begin(plainPort, 0x02, 0x01);
+    plain.sendPayload(COMMAND, data, 16);
+    uint8_t wire[sizeof(PacketHeader) + 16 + sizeof(uint16_t)];
+    expect(tapPort.readBytes(wire, sizeof(wire)) == sizeof(wire) && memcmp(wire + sizeof(PacketHeader), data, 16) == 0,
+           "Crypto = false leaves the payload unencrypted");
+#endif
+}
+#endif
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+// Yoklamalar yalnızca kendi ID'mize gelince yanıtlanır // Pings are answered only when they come to our own ID
+static void checkTiming() {
+    Pair pair;
+    StarDustTiming slave;
+    slave.begin(pair.receiver);
+
+    HeartbeatSyncPayload ping = {STARDUST_HEARTBEAT_PING, 1, micros(), 0, 0};
+    pair.sender.sendPayload(BROADCAST_ID, SYSTEMHEARTBEAT, &ping, sizeof(ping));
+    pair.sender.sendPayload(0x03, SYSTEMHEARTBEAT, &ping, sizeof(ping));
+    for (int i = 0; i < 4; i++) slave.update();
+    pair.sender.update();
+    expect(pair.sender.available() == 0, "PING to broadcast or to another ID is not answered");
+
+    StarDustTiming master;
+    master.begin(pair.sender);
+    expect(!master.addPeer(BROADCAST_ID) && !master.ping(BROADCAST_ID), "addPeer() and ping() refuse BROADCAST_ID");
+    expect(master.addPeer(0x01), "addPeer() of a unicast ID");
+    for (int i = 0; i < 4; i++) {
+        master.update();
+        slave.update();
+    }
+    const StarDustTiming::Estimate* estimate = master.estimate(0x01);
+    expect(estimate != nullptr && estimate->samples == 1 && estimate->lost == 0, "PING to the slave's ID is answered");
+}
+
+// Slave'in saati sabit bir farkla ve ppm kaymasıyla ilerler // The slave clock runs with a fixed offset and a ppm drift
+static const uint32_t SKEW_OFFSET = 0x9E3779B9UL;
+static const double SKEW_PPM = 250.0;
+static uint32_t g_skewBase;
+
+static uint32_t skewedAt(uint32_t localTime) {
+    return SKEW_OFFSET + (uint32_t)((double)(localTime - g_skewBase) * (1.0 + SKEW_PPM * 1e-6));
+}
+
+static uint32_t skewedClock() {
+    return skewedAt(micros());
+}
+
+static void stepTiming(StarDustTiming& master, StarDustTiming& slave, uint32_t us) {
+    for (uint32_t t = 0; t < us; t += 50) {
+        master.update();
+        slave.update();
+        HostClock::advance(50);
+    }
+}
+
+// Sahte saatle çalışır: fark ve kayma bilinen değerlere yakınsamalı, yarım çerçeve eşin zaman aşımıyla düşmeli
+// Runs on the manual clock: offset and drift must converge to the known values, a half frame must fall on the peer's timeout
+static void checkClockEstimate() {
+    Pair pair;
+    pair.senderPort.setBaudRate(115200);
+    pair.receiverPort.setBaudRate(115200);
+    pair.sender.setTimeout(1000);
+
+    StarDustTiming master, slave;
+    master.begin(pair.sender);
+    master.addPeer(0x01);
+    master.setInterval(100);
+    master.setTimeoutBounds(2, 4);
+    g_skewBase = micros();
+    slave.begin(pair.receiver);
+    slave.setClock(skewedClock);
+
+    // Kayma 10 s'lik aralıklarla ölçülür; 30 s iki aralık verir // The drift is measured over 10 s spans; 30 s gives two
+    bool bounded = true;
+    for (uint32_t ms = 0; ms < 30000; ms++) {
+        stepTiming(master, slave, 1000);
+        const uint32_t timeout = master.timeout(0x01);
+        if (timeout != 0 && (timeout < 2 || timeout > 4)) bounded = false;
+    }
+    const StarDustTiming::Estimate* estimate = master.estimate(0x01);
+    expect(estimate != nullptr && estimate->driftValid && estimate->lost == 0, "30 s of pings give a drift estimate");
+    if (estimate == nullptr) return;
+    expect(bounded && estimate->timeout >= 2 && estimate->timeout <= 4, "timeout() stays within setTimeoutBounds(2, 4): %u ms",
+           (unsigned)estimate->timeout);
+
+    const int32_t offsetError = estimate->offset - (int32_t)(skewedAt(estimate->offsetTime) - estimate->offsetTime);
+    expect(abs(offsetError) <= 50, "offset converges to the slave clock: %d us off", (int)offsetError);
+    expect(fabs(estimate->drift - SKEW_PPM) <= 5.0, "drift converges to %.0f ppm: %.1f ppm", SKEW_PPM, estimate->drift);
+
+    const uint32_t now = micros();
+    const int32_t peerError = (int32_t)(master.toPeerTime(0x01, now) - skewedClock());
+    expect(abs(peerError) <= 50, "toPeerTime() follows the slave clock: %d us off", (int)peerError);
+    bool roundTrip = true;
+    static const int32_t shifts[] = {0, 1000000, -5000000, 20000000};
+    for (size_t i = 0; i < sizeof(shifts) / sizeof(shifts[0]); i++) {
+        const uint32_t peerTime = skewedClock() + (uint32_t)shifts[i];
+        if (abs((int32_t)(master.toPeerTime(0x01, master.toLocalTime(0x01, peerTime)) - peerTime)) > 2) roundTrip = false;
+    }
+    expect(roundTrip, "toPeerTime(toLocalTime(t)) returns t");
+
+    // Yanıt işlendikten hemen sonra hat boştur; slave kaynaklı yarım çerçeve master'a verilir
+    // Right after an echo is handled the line is idle; a half frame from the slave is handed to the master
+    const uint32_t samples = estimate->samples;
+    const uint32_t lost = estimate->lost;
+    while (estimate->samples == samples) stepTiming(master, slave, 50);
+    LoopbackStream tap;
+    StarDust peer;
+    peer.begin(tap, 0x01, 0x02);
+    HeartbeatSyncPayload ping = {STARDUST_HEARTBEAT_PING, 1, micros(), 0, 0};
+    peer.sendPayload(SYSTEMHEARTBEAT, &ping, sizeof(ping));
+    uint8_t frame[MAX_FRAME_SIZE];
+    tap.readBytes(frame, sizeof(frame));
+    pair.receiverPort.inject(frame, sizeof(PacketHeader) + 4);
+
+#if STARDUST_STATS
+    const uint32_t timedOut = pair.sender.stats().framesTimedOut;
+    for (uint32_t us = 0; us < 3000; us += 50) {
+        pair.sender.update();
+        HostClock::advance(50);
+    }
+    expect(pair.sender.stats().framesTimedOut == timedOut, "the half frame is still open 3 ms later");
+    for (uint32_t us = 0; us < 3000; us += 50) {
+        pair.sender.update();
+        HostClock::advance(50);
+    }
+    expect(pair.sender.stats().framesTimedOut == timedOut + 1, "the half frame times out on the peer's %u ms, not on setTimeout(1000)",
+           (unsigned)estimate->timeout);
+#endif
+    // Yarım çerçeve açık kalsaydı sıradaki yanıtı yutardı // Had the half frame stayed open it would swallow the next echo
+    stepTiming(master, slave, 150000);
+    expect(estimate->samples >= samples + 2 && estimate->lost == lost, "the echo after the stalled half frame is received");
+}
+#endif
+
+static void run(const char* name, void (*check)()) {
+    const uint32_t failures = g_failures;
+    const uint32_t checks = g_checks;
+    check();
+    printf("%-28s %6u checks  %s\n", name, (unsigned)(g_checks - checks), g_failures == failures ? "ok" : "FAILED");
+}
+
+int main() {
+    printf("StarDust regression checks (framing %d, variable frames %d, CRC mode %d, cipher mode %d, PAYLOADSIZE %u)\n",
+           STARDUST_FRAMING, STARDUST_VARIABLE_FRAMES, STARDUST_CRC_MODE, STARDUST_CIPHER_MODE, (unsigned)PAYLOADSIZE);
+    run("CRC16 / CRC32", checkCrc);
+    run("cipher", checkCipher);
+    run("every packet type", checkRawTypes);
+    run("sendX / receiveX", checkTypedHelpers);
+#if STARDUST_AGGREGATION && STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST) && STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+    run("aggregation", checkAggregation);
+#endif
+#if STARDUST_TELEMETRY_PEERS > 0
+    run("compact telemetry", checkCompactTelemetry);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+    run("address filter", checkAddressFilter);
+#endif
+#if STARDUST_TX_QUEUE_DEPTH > 0 && \
+    STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY | STARDUST_TYPE_EMERGENCY | STARDUST_TYPE_ERROR | STARDUST_TYPE_SYSTEMCOMMAND)
+    run("transmit priority", checkTxPriority);
+#endif
+#if STARDUST_VARIABLE_FRAMES && STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST) && STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+    run("per-instance settings", checkInstanceSettings);
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+    run("link timing", checkTiming);
+    HostClock::setManual(true);
+    run("clock estimate", checkClockEstimate);
+    HostClock::setManual(false);
+#endif
+    run("bit errors", checkBitErrors);
+    run("line noise", checkNoise);
+    run("dropped bytes", checkByteLoss);
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+    HostClock::setManual(true);
+    run("reliable delivery", checkReliable);
+    run("bulk transfer", checkTransfer);
+    HostClock::setManual(false);
+#endif
+    printf("%u checks, %u failed\n", (unsigned)g_checks, (unsigned)g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
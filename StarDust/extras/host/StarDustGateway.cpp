@@ -0,0 +1,366 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Linux Gateway
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustGateway.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+static constexpr uint64_t WAKE_TAG = ~(uint64_t)0;
+static constexpr size_t FEED_STEP = 64; // Alım kuyruğu taşmasın diye feed() adımı // feed() step, so the receive queue does not overflow
+
+static bool baudConstant(uint32_t baud, speed_t* out) {
+    switch (baud) {
+        case 9600: *out = B9600; return true;
+        case 19200: *out = B19200; return true;
+        case 38400: *out = B38400; return true;
+        case 57600: *out = B57600; return true;
+        case 115200: *out = B115200; return true;
+        case 230400: *out = B230400; return true;
+        case 460800: *out = B460800; return true;
+        case 921600: *out = B921600; return true;
+        default: return false;
+    }
+}
+
+// ======================== BAĞLANTI PORTU ========================
+// ======================== LINK PORT =============================
+StarDustGateway::LinkPort::LinkPort(StarDustGateway* owner, size_t linkIndex)
+    : gateway(owner), index(linkIndex), tx(new uint8_t[TX_BUFFER]), txHead(0), txTail(0) {}
+
+size_t StarDustGateway::LinkPort::write(const uint8_t* buffer, size_t size) {
+    // Çerçeve ya tamamen ya hiç: yarım çerçeve hattı bozar // A frame goes in whole or not at all: half a frame corrupts the line
+    if (size > TX_BUFFER - (txHead - txTail)) {
+        gateway->_stats.txDropped++;
+        return 0;
+    }
+    for (size_t i = 0; i < size; i++) {
+        tx[(txHead + i) & (TX_BUFFER - 1)] = buffer[i];
+    }
+    txHead += size;
+    Link& link = *gateway->_links[index];
+    if (!link.dirty) {
+        link.dirty = true;
+        gateway->_dirty.push_back(index);
+    }
+    return size;
+}
+
+int StarDustGateway::LinkPort::availableForWrite() {
+    return (int)(TX_BUFFER - (txHead - txTail));
+}
+
+StarDustGateway::Link::Link(StarDustGateway* gateway, size_t index, int linkFd, bool owns)
+    : fd(linkFd), ownsFd(owns), dirty(false), waitingOut(false), closed(false), port(gateway, index) {}
+
+// ======================== KURULUM ========================
+// ======================== SETUP ==========================
+StarDustGateway::StarDustGateway(size_t workers) : _running(false), _handler(nullptr), _handlerContext(nullptr) {
+    memset(&_stats, 0, sizeof(_stats));
+    _lastSweep = millis();
+    _epoll = epoll_create1(EPOLL_CLOEXEC);
+    _wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = WAKE_TAG;
+    epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeFd, &event);
+
+    for (size_t i = 0; i < workers; i++) {
+        _workers.emplace_back(new Worker());
+        Worker& worker = *_workers.back();
+        worker.stopping = false;
+        worker.thread = std::thread(&StarDustGateway::workerLoop, this, std::ref(worker));
+    }
+}
+
+StarDustGateway::~StarDustGateway() {
+    for (size_t i = 0; i < _workers.size(); i++) {
+        Worker& worker = *_workers[i];
+        {
+            std::lock_guard<std::mutex> guard(worker.lock);
+            worker.stopping = true;
+        }
+        worker.wake.notify_one();
+        worker.thread.join();
+    }
+    for (size_t i = 0; i < _links.size(); i++) {
+        if (_links[i]->ownsFd) ::close(_links[i]->fd);
+    }
+    ::close(_wakeFd);
+    ::close(_epoll);
+}
+
+int StarDustGateway::openLink(const char* path, uint32_t baud, uint8_t myID, uint8_t targetID) {
+    speed_t speed = 0;
+    if (baud != 0 && !baudConstant(baud, &speed)) return -1;
+    const int fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) return -1;
+
+    // Ham kip: satır disiplini 0x0A/0x0D veya kontrol byte'larını değiştirmemeli
+    // Raw mode: the line discipline must not alter 0x0A/0x0D or control bytes
+    struct termios tio;
+    bool configured = tcgetattr(fd, &tio) == 0;
+    if (configured) {
+        cfmakeraw(&tio);
+        tio.c_cflag |= CLOCAL | CREAD;
+        if (baud != 0) configured = cfsetispeed(&tio, speed) == 0 && cfsetospeed(&tio, speed) == 0;
+        configured = configured && tcsetattr(fd, TCSANOW, &tio) == 0;
+    }
+    const int index = configured ? addLink(fd, myID, targetID, true) : -1;
+    if (index < 0) ::close(fd);
+    return index;
+}
+
+int StarDustGateway::addLink(int fd, uint8_t myID, uint8_t targetID, bool ownsFd) {
+    if (fd < 0 || fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0) return -1;
+    const size_t index = _links.size();
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = index;
+    if (epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event) != 0) return -1;
+
+    _links.emplace_back(new Link(this, index, fd, ownsFd));
+    _links.back()->node.begin(_links.back()->port, myID, targetID);
+    return (int)index;
+}
+
+void StarDustGateway::onPacket(PacketHandler handler, void* context) {
+    _handler = handler;
+    _handlerContext = context;
+}
+
+// ======================== GÖNDERİM ========================
+// ======================== SENDING =========================
+bool StarDustGateway::send(size_t link, uint8_t target, PacketType type, const void* payload, uint8_t size) {
+    if (link >= _links.size() || size > PAYLOADSIZE) return false;
+    OutFrame frame;
+    frame.link = (uint32_t)link;
+    frame.target = target;
+    frame.type = type;
+    frame.size = size;
+    memcpy(frame.payload, payload, size);
+
+    bool first;
+    {
+        std::lock_guard<std::mutex> guard(_outLock);
+        first = _outbox.empty();
+        _outbox.push_back(frame);
+    }
+    // Yalnızca boş kutuya ilk ekleme uyandırır: bir turdaki gönderimler tek sistem çağrısı
+    // Only the first frame in an empty box wakes: the sends of one round cost one system call
+    if (first) wake();
+    return true;
+}
+
+void StarDustGateway::drainOutbox() {
+    {
+        std::lock_guard<std::mutex> guard(_outLock);
+        _outSpare.swap(_outbox);
+    }
+    for (size_t i = 0; i < _outSpare.size(); i++) {
+        const OutFrame& frame = _outSpare[i];
+        _links[frame.link]->node.sendPayload(frame.target, (PacketType)frame.type, frame.payload, frame.size);
+    }
+    _outSpare.clear();
+}
+
+void StarDustGateway::flush(Link& link) {
+    LinkPort& port = link.port;
+    while (port.txHead != port.txTail) {
+        // Halka en çok iki parça: tek writev // The ring is at most two pieces: one writev
+        const size_t pending = port.txHead - port.txTail;
+        const size_t start = port.txTail & (TX_BUFFER - 1);
+        const size_t first = (pending < TX_BUFFER - start) ? pending : TX_BUFFER - start;
+        struct iovec iov[2];
+        iov[0].iov_base = &port.tx[start];
+        iov[0].iov_len = first;
+        iov[1].iov_base = &port.tx[0];
+        iov[1].iov_len = pending - first;
+        const ssize_t written = writev(link.fd, iov, (pending > first) ? 2 : 1);
+        _stats.writes++;
+        if (written > 0) {
+            port.txTail += written;
+            _stats.bytesOut += written;
+        } else if (written < 0 && errno == EINTR) {
+            continue;
+        } else {
+            break; // EAGAIN: çekirdek tamponu dolu, EPOLLOUT beklenir // EAGAIN: kernel buffer full, wait for EPOLLOUT
+        }
+    }
+
+    const bool waiting = port.txHead != port.txTail;
+    if (waiting != link.waitingOut) {
+        struct epoll_event event;
+        event.events = EPOLLIN | (waiting ? EPOLLOUT : 0);
+        event.data.u64 = port.index;
+        epoll_ctl(_epoll, EPOLL_CTL_MOD, link.fd, &event);
+        link.waitingOut = waiting;
+    }
+}
+
+// ======================== ALIM ========================
+// ======================== RECEIVING ===================
+uint32_t StarDustGateway::deliver(size_t index) {
+    Link& link = *_links[index];
+    link.node.update();
+    uint32_t count = 0;
+    Item item;
+    item.link = (uint32_t)index;
+    while (link.node.pop(item.packet)) {
+        if (_workers.empty()) {
+            if (_handler != nullptr) _handler(index, item.packet, _handlerContext);
+        } else {
+            // Bağlantının tüm paketleri aynı işçiye: sıra korunur // Every packet of a link goes to the same worker: order is kept
+            _workers[index % _workers.size()]->batch.push_back(item);
+        }
+        count++;
+    }
+    return count;
+}
+
+void StarDustGateway::readLink(size_t index) {
+    Link& link = *_links[index];
+    // Zaman aşımı denetimi feed() öncesinde (bekleyen feed byte'ları hat etkinliği sayılır)
+    // Timeout check before feed() (pending feed bytes count as line activity)
+    link.node.update();
+
+    uint8_t buffer[READ_CHUNK];
+    for (;;) {
+        const ssize_t length = ::read(link.fd, buffer, sizeof(buffer));
+        _stats.reads++;
+        if (length < 0 && (errno == EAGAIN || errno == EINTR)) break;
+        if (length <= 0) {
+            // Karşı taraf kapandı (pty'de EIO): fd epoll'dan çıkarılır, yoksa HUP her turda döner
+            // The other side has closed (EIO on a pty): the fd leaves epoll, otherwise HUP would return every round
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, link.fd, nullptr);
+            link.closed = true;
+            break;
+        }
+        _stats.bytesIn += length;
+        size_t offset = 0;
+        while (offset < (size_t)length) {
+            const size_t step = ((size_t)length - offset < FEED_STEP) ? (size_t)length - offset : FEED_STEP;
+            offset += link.node.feed(buffer + offset, step);
+            _stats.packets += deliver(index);
+        }
+        if ((size_t)length < sizeof(buffer)) break; // Kısa okuma: çekirdekte kalan yok // Short read: nothing left in the kernel
+    }
+}
+
+int StarDustGateway::poll(int timeoutMs) {
+    struct epoll_event events[64];
+    const int ready = epoll_wait(_epoll, events, 64, timeoutMs);
+    _stats.wakeups++;
+    const uint64_t before = _stats.packets;
+
+    for (int i = 0; i < ready; i++) {
+        if (events[i].data.u64 == WAKE_TAG) {
+            uint64_t value;
+            while (::read(_wakeFd, &value, sizeof(value)) > 0) {}
+            drainOutbox();
+            continue;
+        }
+        const size_t index = (size_t)events[i].data.u64;
+        if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) readLink(index);
+        if ((events[i].events & EPOLLOUT) && !_links[index]->closed) flush(*_links[index]);
+    }
+
+    // Sessiz bağlantılarda da zaman aşımı ve toplama gecikmesi işlesin // Timeouts and the aggregation delay also work on quiet links
+    const uint32_t now = millis();
+    if (now - _lastSweep >= 100) {
+        _lastSweep = now;
+        for (size_t i = 0; i < _links.size(); i++) _stats.packets += deliver(i);
+    }
+
+    // Bu turda yazılan her bağlantı için tek writev // One writev for every link written in this round
+    for (size_t i = 0; i < _dirty.size(); i++) {
+        Link& link = *_links[_dirty[i]];
+        link.dirty = false;
+        if (!link.closed) flush(link);
+    }
+    _dirty.clear();
+
+    // Turun paketleri işçi başına tek kilit ve tek uyandırmayla devredilir
+    // The round's packets are handed over with one lock and one wake-up per worker
+    for (size_t w = 0; w < _workers.size(); w++) {
+        Worker& worker = *_workers[w];
+        if (worker.batch.empty()) continue;
+        bool idle;
+        {
+            std::lock_guard<std::mutex> guard(worker.lock);
+            idle = worker.queue.empty();
+            worker.queue.insert(worker.queue.end(), worker.batch.begin(), worker.batch.end());
+        }
+        worker.batch.clear();
+        if (idle) worker.wake.notify_one();
+    }
+    return (int)(_stats.packets - before);
+}
+
+void StarDustGateway::run() {
+    _running = true;
+    while (_running) {
+        poll(100); // Süreli uyanış: sessiz hatta da zamanlayıcılar işler // Timed wake-up: timers work on a quiet line too
+    }
+}
+
+void StarDustGateway::stop() {
+    _running = false;
+    wake();
+}
+
+void StarDustGateway::wake() {
+    const uint64_t one = 1;
+    const ssize_t result = ::write(_wakeFd, &one, sizeof(one));
+    (void)result;
+}
+
+// ======================== İŞÇİLER ========================
+// ======================== WORKERS ========================
+void StarDustGateway::workerLoop(Worker& worker) {
+    std::vector<Item> local;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(worker.lock);
+            worker.wake.wait(guard, [&worker] { return worker.stopping || !worker.queue.empty(); });
+            if (worker.queue.empty()) return;
+            local.swap(worker.queue);
+        }
+        for (size_t i = 0; i < local.size(); i++) {
+            if (_handler != nullptr) _handler(local[i].link, local[i].packet, _handlerContext);
+        }
+        local.clear();
+    }
+}
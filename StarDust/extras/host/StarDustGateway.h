@@ -0,0 +1,173 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Linux Gateway
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Ground station engine for many serial links on Linux. One I/O thread waits on every
+tty/pty with epoll, reads whatever arrived in one read() per link and feeds it to that
+link's StarDust parser, and writes each link's pending frames with a single writev().
+Validated packets go to a pool of worker threads; all packets of a link go to the same
+worker, so they are handled in arrival order. Not part of the Arduino library.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_GATEWAY_H
+#define STARDUST_GATEWAY_H
+
+#include "StarDust.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static_assert(STARDUST_FEED_BUFFER_SIZE > 0, "StarDustGateway parses through feed(), STARDUST_FEED_BUFFER_SIZE must not be 0");
+
+class StarDustGateway {
+public:
+    // İşçi sayısı 0 ise işleyici G/Ç iş parçacığında çağrılır // With 0 workers the handler runs on the I/O thread
+    typedef void (*PacketHandler)(size_t link, const PacketData& packet, void* context);
+
+    struct Stats {
+        uint64_t wakeups;     // epoll_wait dönüşleri // epoll_wait returns
+        uint64_t reads;       // read() çağrıları // read() calls
+        uint64_t writes;      // writev() çağrıları // writev() calls
+        uint64_t bytesIn;
+        uint64_t bytesOut;
+        uint64_t packets;
+        uint64_t txDropped;   // Gönderim tamponu dolu olduğu için atılan çerçeveler // Frames dropped because the transmit buffer was full
+    };
+
+    explicit StarDustGateway(size_t workers = 0);
+    ~StarDustGateway();
+
+    // Ham kipte açar; baud 0 ise hız değiştirilmez (pty). Bağlantı sırasını döndürür, hata: -1
+    // Opens in raw mode; baud 0 leaves the speed as it is (pty). Returns the link index, -1 on error
+    int openLink(const char* path, uint32_t baud, uint8_t myID, uint8_t targetID = 0);
+    // Açık ve ayarlanmış bir fd; ownsFd ise yıkıcı kapatır // An open, configured fd; closed by the destructor if ownsFd
+    int addLink(int fd, uint8_t myID, uint8_t targetID = 0, bool ownsFd = false);
+    size_t links() const { return _links.size(); }
+    // Anahtar, süzgeç vb. ayarlar için; run() başladıktan sonra yalnızca G/Ç iş parçacığı dokunmalıdır
+    // For keys, filters and the like; once run() has started only the I/O thread may touch it
+    StarDust& link(size_t index) { return _links[index]->node; }
+    bool connected(size_t index) const { return !_links[index]->closed; } // Karşı taraf kapanınca false // false once the other side has closed
+
+    void onPacket(PacketHandler handler, void* context = nullptr);
+
+    // Her iş parçacığından çağrılabilir: çerçeve G/Ç iş parçacığında kurulur ve writev ile yazılır
+    // Callable from any thread: the frame is built on the I/O thread and written with writev
+    bool send(size_t link, uint8_t target, PacketType type, const void* payload, uint8_t size);
+
+    int poll(int timeoutMs);  // Tek epoll turu, işlenen paket sayısını döndürür // One epoll round, returns the packets handled
+    void run();               // stop() çağrılana kadar poll() // poll() until stop() is called
+    void stop();              // Her iş parçacığından // From any thread
+    const Stats& stats() const { return _stats; }
+
+private:
+    static constexpr size_t TX_BUFFER = 16384; // Bağlantı başına, 2'nin kuvveti // Per link, power of two
+    static constexpr size_t READ_CHUNK = 4096;
+
+    // StarDust'ın yazdığı çerçeveler halka tampona gider, hatta writev ile çıkar
+    // Frames written by StarDust go to a ring buffer and leave through writev
+    class LinkPort : public Stream {
+    public:
+        LinkPort(StarDustGateway* gateway, size_t index);
+        size_t write(const uint8_t* buffer, size_t size) override;
+        int availableForWrite() override;
+
+        StarDustGateway* gateway;
+        size_t index;
+        std::unique_ptr<uint8_t[]> tx;
+        size_t txHead;        // Yazılan // Written
+        size_t txTail;        // Hatta çıkan // Sent to the line
+    };
+
+    struct Link {
+        Link(StarDustGateway* gateway, size_t index, int fd, bool ownsFd);
+        int fd;
+        bool ownsFd;
+        bool dirty;           // Gönderilecek byte var // Has bytes to send
+        bool waitingOut;      // EPOLLOUT bekleniyor // Waiting for EPOLLOUT
+        bool closed;
+        LinkPort port;
+        StarDust node;
+    };
+
+    struct Item {
+        uint32_t link;
+        PacketData packet;
+    };
+
+    struct Worker {
+        std::thread thread;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::vector<Item> queue;
+        std::vector<Item> batch; // G/Ç iş parçacığında bu turun paketleri // This round's packets on the I/O thread
+        bool stopping;
+    };
+
+    struct OutFrame {
+        uint32_t link;
+        uint8_t target;
+        uint8_t type;
+        uint8_t size;
+        uint8_t payload[PAYLOADSIZE];
+    };
+
+    int _epoll;
+    int _wakeFd;              // eventfd: send() ve stop() G/Ç iş parçacığını uyandırır // eventfd: send() and stop() wake the I/O thread
+    std::atomic<bool> _running;
+    uint32_t _lastSweep;
+    PacketHandler _handler;
+    void* _handlerContext;
+    Stats _stats;
+    std::vector<std::unique_ptr<Link> > _links;
+    std::vector<size_t> _dirty;
+    std::vector<std::unique_ptr<Worker> > _workers;
+
+    std::mutex _outLock;
+    std::vector<OutFrame> _outbox;
+    std::vector<OutFrame> _outSpare;
+
+    void readLink(size_t index);
+    uint32_t deliver(size_t index);
+    void flush(Link& link);
+    void drainOutbox();
+    void wake();
+    void workerLoop(Worker& worker);
+};
+
+#endif
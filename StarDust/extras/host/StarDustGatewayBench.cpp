@@ -0,0 +1,303 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Gateway Benchmark
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Scaling harness for StarDustGateway over local pseudo terminals. A generator thread plays
+one vehicle per pty and sends telemetry at the full rate of a 115200 baud line; the
+gateway answers every 16th frame. The same load is then read by the classic busy loop
+(one StarDust per port, polled in turn) for comparison.
+Usage: stardust_gateway_bench [scale]   (scale 1 = 2 s per row)
+
+*/
+
+#include "StarDustGateway.h"
+#include "StarDustHost.h"
+
+#include <atomic>
+#include <chrono>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const uint32_t BAUD = 115200;
+
+struct LinkTally {
+    uint64_t packets;
+    uint64_t latencySum;
+    uint32_t latencyMax;
+    uint32_t nextSeq;
+    uint64_t outOfOrder;
+    uint8_t pad[32]; // İşçiler arası yanlış paylaşımı azaltır // Reduces false sharing between workers
+};
+
+struct Harness {
+    StarDustGateway* gateway;
+    std::vector<LinkTally> tally;
+};
+
+static double threadSeconds(pthread_t thread) {
+    clockid_t clock;
+    struct timespec ts;
+    if (pthread_getcpuclockid(thread, &clock) != 0 || clock_gettime(clock, &ts) != 0) return 0.0;
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double processSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Bağlantının tüm paketleri aynı iş parçacığında işlenir, sayaçlar kilitsizdir
+// Every packet of a link is handled on the same thread, the counters need no lock
+static void tallyPacket(Harness& harness, size_t link, const PacketData& packet) {
+    if (packet.header.type != TELEMETRY) return;
+    TelemetryPayload tel;
+    memcpy(&tel, packet.payload, sizeof(tel));
+    const uint32_t latency = micros() - tel.timestamp;
+    const uint32_t seq = (uint32_t)tel.latitude;
+    LinkTally& tally = harness.tally[link];
+    if (seq != tally.nextSeq) tally.outOfOrder++;
+    tally.nextSeq = seq + 1;
+    tally.packets++;
+    tally.latencySum += latency;
+    if (latency > tally.latencyMax) tally.latencyMax = latency;
+
+    if (harness.gateway != nullptr && (seq & 15) == 15) {
+        const AcceptPayload ack = {1, 0, true};
+        harness.gateway->send(link, packet.header.source, ACCEPT, &ack, sizeof(ack));
+    }
+}
+
+static void onGatewayPacket(size_t link, const PacketData& packet, void* context) {
+    tallyPacket(*(Harness*)context, link, packet);
+}
+
+// Araçlar: her pty'ye hattın tam hızında telemetri yazar, gelen onayları sayar
+// Vehicles: write telemetry to every pty at the full line rate, count the acks that come back
+struct Vehicles {
+    std::vector<std::unique_ptr<PtyStream> > ports;
+    std::vector<std::unique_ptr<StarDust> > nodes;
+    std::atomic<bool> running;
+    uint64_t sent;
+    uint64_t acks;
+};
+
+static void runVehicles(Vehicles& vehicles) {
+    const double frameBytes = sizeof(PacketHeader) + sizeof(TelemetryPayload) + 2 + STARDUST_FRAMING_OVERHEAD;
+    const double rate = BAUD / 10.0 / frameBytes; // Bağlantı başına çerçeve/s // Frames/s per link
+    const size_t links = vehicles.nodes.size();
+    std::vector<uint32_t> seq(links, 0);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    PacketData packet;
+    while (vehicles.running) {
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const uint32_t due = (uint32_t)(elapsed * rate);
+        for (size_t i = 0; i < links; i++) {
+            while (seq[i] < due) {
+                const TelemetryPayload tel = {1, (double)seq[i], 28.9784, 120.5, 1.5f, -0.25f, micros(), 0};
+                vehicles.nodes[i]->send(tel);
+                seq[i]++;
+                vehicles.sent++;
+            }
+            vehicles.nodes[i]->update();
+            while (vehicles.nodes[i]->pop(packet)) {
+                if (packet.header.type == ACCEPT) vehicles.acks++;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+static bool openVehicles(Vehicles& vehicles, size_t links) {
+    for (size_t i = 0; i < links; i++) {
+        vehicles.ports.emplace_back(new PtyStream());
+        vehicles.nodes.emplace_back(new StarDust());
+        if (!vehicles.ports.back()->openMaster()) return false;
+        vehicles.nodes.back()->begin(*vehicles.ports.back(), 0x01, 0x00);
+    }
+    vehicles.sent = 0;
+    vehicles.acks = 0;
+    return true;
+}
+
+struct Row {
+    double cpuIo;       // G/Ç veya yoklama iş parçacığı // I/O or polling thread
+    double cpuWorkers;
+    double seconds;
+    uint64_t syscalls;
+    uint64_t packets;   // Ölçüm penceresinde // In the measured window
+};
+
+static uint64_t totalPackets(const Harness& harness) {
+    uint64_t packets = 0;
+    for (size_t i = 0; i < harness.tally.size(); i++) packets += harness.tally[i].packets;
+    return packets;
+}
+
+static void printRow(const char* label, size_t links, const Vehicles& vehicles, const Harness& harness, const Row& row) {
+    uint64_t latencySum = 0, outOfOrder = 0;
+    uint32_t latencyMax = 0;
+    const uint64_t packets = totalPackets(harness);
+    for (size_t i = 0; i < links; i++) {
+        latencySum += harness.tally[i].latencySum;
+        outOfOrder += harness.tally[i].outOfOrder;
+        if (harness.tally[i].latencyMax > latencyMax) latencyMax = harness.tally[i].latencyMax;
+    }
+    printf("  %-22s %5u %10.0f %10.1f %9.0f %9.1f %7u %8.1f %8.1f %9.2f %7u\n", label, (unsigned)links,
+           row.packets / row.seconds, vehicles.sent ? 100.0 * packets / vehicles.sent : 0.0,
+           packets ? (double)latencySum / packets : 0.0, latencyMax / 1000.0, (unsigned)outOfOrder,
+           100.0 * row.cpuIo / row.seconds, 100.0 * row.cpuWorkers / row.seconds,
+           row.packets ? (double)row.syscalls / row.packets : 0.0, (unsigned)vehicles.acks);
+}
+
+static void benchGateway(size_t links, size_t workers, double duration) {
+    Vehicles vehicles;
+    if (!openVehicles(vehicles, links)) {
+        printf("  %u ptys not available, skipped\n", (unsigned)links);
+        return;
+    }
+    Harness harness;
+    harness.tally.assign(links, LinkTally());
+    std::unique_ptr<StarDustGateway> gateway(new StarDustGateway(workers));
+    harness.gateway = gateway.get();
+    gateway->onPacket(onGatewayPacket, &harness);
+    for (size_t i = 0; i < links; i++) {
+        if (gateway->openLink(vehicles.ports[i]->slaveName(), BAUD, 0x00, 0x01) < 0) {
+            printf("  opening %s failed, skipped\n", vehicles.ports[i]->slaveName());
+            return;
+        }
+    }
+
+    vehicles.running = true;
+    std::thread io(&StarDustGateway::run, gateway.get());
+    std::thread generator(runVehicles, std::ref(vehicles));
+
+    // Isınmadan sonra ölçülen pencere // The measured window after a warm-up
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const double io0 = threadSeconds(io.native_handle());
+    const double gen0 = threadSeconds(generator.native_handle());
+    const double all0 = processSeconds();
+    const uint64_t calls0 = gateway->stats().wakeups + gateway->stats().reads + gateway->stats().writes;
+    const uint64_t packets0 = gateway->stats().packets;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(duration * 1e6)));
+    Row row;
+    row.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    row.cpuIo = threadSeconds(io.native_handle()) - io0;
+    row.cpuWorkers = processSeconds() - all0 - row.cpuIo - (threadSeconds(generator.native_handle()) - gen0);
+    row.syscalls = gateway->stats().wakeups + gateway->stats().reads + gateway->stats().writes - calls0;
+    row.packets = gateway->stats().packets - packets0;
+
+    vehicles.running = false;
+    generator.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    gateway->stop();
+    io.join();
+    gateway.reset(); // İşçiler durur, sayaçlar güvenle okunur // Workers stop, the counters are safe to read
+
+    char label[32];
+    snprintf(label, sizeof(label), "gateway, %u workers", (unsigned)workers);
+    printRow(label, links, vehicles, harness, row);
+}
+
+static void benchBusyLoop(size_t links, double duration) {
+    Vehicles vehicles;
+    if (!openVehicles(vehicles, links)) {
+        printf("  %u ptys not available, skipped\n", (unsigned)links);
+        return;
+    }
+    Harness harness;
+    harness.gateway = nullptr;
+    harness.tally.assign(links, LinkTally());
+    std::vector<std::unique_ptr<PtyStream> > ports;
+    std::vector<std::unique_ptr<StarDust> > nodes;
+    for (size_t i = 0; i < links; i++) {
+        ports.emplace_back(new PtyStream());
+        nodes.emplace_back(new StarDust());
+        if (!ports.back()->openSlave(vehicles.ports[i]->slaveName())) {
+            printf("  opening %s failed, skipped\n", vehicles.ports[i]->slaveName());
+            return;
+        }
+        nodes.back()->begin(*ports.back(), 0x00, 0x01);
+    }
+
+    // Eski yöntem: her port sırayla update() ile yoklanır, çekirdek hiç uyumaz
+    // The old way: every port is polled in turn with update(), the core never sleeps
+    std::atomic<bool> polling(true);
+    std::thread poller([&]() {
+        PacketData packet;
+        while (polling) {
+            for (size_t i = 0; i < links; i++) {
+                nodes[i]->update();
+                while (nodes[i]->pop(packet)) tallyPacket(harness, i, packet);
+            }
+        }
+    });
+
+    vehicles.running = true;
+    std::thread generator(runVehicles, std::ref(vehicles));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const double poll0 = threadSeconds(poller.native_handle());
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t packets0 = totalPackets(harness);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(duration * 1e6)));
+    Row row;
+    row.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    row.cpuIo = threadSeconds(poller.native_handle()) - poll0;
+    row.cpuWorkers = 0.0;
+    row.syscalls = 0; // update() başına available()+read(): sayılmaz // available()+read() per update(): not counted
+    row.packets = totalPackets(harness) - packets0;
+
+    vehicles.running = false;
+    generator.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    polling = false;
+    poller.join();
+    printRow("busy loop, 1 thread", links, vehicles, harness, row);
+}
+
+int main(int argc, char** argv) {
+    double scale = (argc > 1) ? atof(argv[1]) : 1.0;
+    if (scale <= 0.0) scale = 1.0;
+    const double duration = 2.0 * scale;
+
+    printf("StarDust gateway over pseudo terminals: telemetry at the full rate of %u baud per link,\n", (unsigned)BAUD);
+    printf("one ACCEPT back every 16 frames (rates over the measured window, latency and order over the whole run)\n");
+    printf("  %-22s %5s %10s %10s %9s %9s %7s %8s %8s %9s %7s\n", "reader", "links", "frames/s", "delivered%", "lat µs",
+           "max ms", "order", "I/O cpu%", "wrk cpu%", "calls/fr", "acks");
+    static const size_t counts[] = {1, 8, 32, 64};
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        benchGateway(counts[c], 2, duration);
+    }
+    benchBusyLoop(8, duration);
+    benchBusyLoop(32, duration);
+    return 0;
+}
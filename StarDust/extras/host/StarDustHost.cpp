@@ -0,0 +1,372 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Host Support
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustHost.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// ======================== ZAMAN ========================
+// ======================== TIME =========================
+static const std::chrono::steady_clock::time_point g_start = std::chrono::steady_clock::now();
+
+static bool g_manualClock = false;
+static uint64_t g_manualMicros = 0;
+
+static uint64_t hostMicros() {
+    if (g_manualClock) return g_manualMicros;
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_start).count();
+}
+
+uint32_t millis() {
+    return (uint32_t)(hostMicros() / 1000);
+}
+
+uint32_t micros() {
+    return (uint32_t)hostMicros();
+}
+
+void HostClock::setManual(bool manual) {
+    g_manualMicros = hostMicros();
+    g_manualClock = manual;
+}
+
+void HostClock::advance(uint32_t us) {
+    g_manualMicros += us;
+}
+
+// ======================== LOOPBACK ========================
+LoopbackStream::LoopbackStream()
+    : _peer(this), _rxPos(0), _bitErrorRate(0.0), _seed(1), _writeWindow(0), _bytesWritten(0), _bitsFlipped(0),
+      _byteTime(0.0), _lineFree(0.0), _txBuffer(0) {}
+
+void LoopbackStream::connect(LoopbackStream& peer) {
+    _peer = &peer;
+    peer._peer = this;
+}
+
+size_t LoopbackStream::write(const uint8_t* buffer, size_t size) {
+    if (_writeWindow > 0 && size > (size_t)_writeWindow) size = _writeWindow;
+    double start = 0.0;
+    if (_byteTime > 0.0) {
+        // Tampon dolu olsa da hepsi kabul edilir (tek iş parçacıklı benzetimde write() bekleyemez)
+        // Everything is accepted even with a full buffer (write() cannot wait in a single threaded simulation)
+        start = std::max((double)hostMicros(), _lineFree);
+        _lineFree = start + size * _byteTime;
+    }
+    _bytesWritten += size;
+    if (_bitErrorRate <= 0.0) {
+        _peer->receive(buffer, size, start, _byteTime);
+        return size;
+    }
+
+    // Bit hataları yalnızca karşıya giden kopyaya uygulanır
+    // Bit errors are applied only to the copy handed to the other side
+    const uint32_t threshold = (uint32_t)(_bitErrorRate * 4294967295.0);
+    for (size_t i = 0; i < size; i++) {
+        uint8_t byte = buffer[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (nextRandom() < threshold) {
+                byte ^= (uint8_t)(1 << bit);
+                _bitsFlipped++;
+            }
+        }
+        _peer->receive(&byte, 1, start + i * _byteTime, _byteTime);
+    }
+    return size;
+}
+
+int LoopbackStream::availableForWrite() {
+    if (_byteTime > 0.0) {
+        const double backlog = (_lineFree - (double)hostMicros()) / _byteTime; // Hatta bekleyen byte'lar // Bytes waiting for the line
+        return (backlog <= 0.0) ? _txBuffer : std::max(0, _txBuffer - (int)backlog);
+    }
+    return (_writeWindow > 0) ? _writeWindow : 4096;
+}
+
+size_t LoopbackStream::arrived() {
+    if (_rxTime.empty()) return _rx.size();
+    // Varış anları artan sıradadır // Arrival times are in ascending order
+    const uint32_t now = micros();
+    return std::upper_bound(_rxTime.begin() + _rxPos, _rxTime.end(), now) - _rxTime.begin();
+}
+
+int LoopbackStream::available() {
+    return (int)(arrived() - _rxPos);
+}
+
+int LoopbackStream::read() {
+    if (_rxPos == arrived()) return -1;
+    return _rx[_rxPos++];
+}
+
+size_t LoopbackStream::readBytes(uint8_t* out, size_t size) {
+    const size_t end = arrived();
+    const size_t count = (size < end - _rxPos) ? size : end - _rxPos;
+    memcpy(out, _rx.data() + _rxPos, count);
+    _rxPos += count;
+    return count;
+}
+
+void LoopbackStream::setBitErrorRate(double rate, uint32_t seed) {
+    _bitErrorRate = rate;
+    _seed = seed ? seed : 1;
+}
+
+void LoopbackStream::inject(const uint8_t* data, size_t size) {
+    _peer->receive(data, size);
+}
+
+void LoopbackStream::setWriteWindow(int bytes) {
+    _writeWindow = bytes;
+}
+
+void LoopbackStream::setBaudRate(uint32_t baud, int txBuffer) {
+    _byteTime = (baud > 0) ? 10.0e6 / baud : 0.0; // 8N1: byte başına 10 bit // 8N1: 10 bits per byte
+    _lineFree = 0.0;
+    _txBuffer = txBuffer;
+}
+
+void LoopbackStream::clear() {
+    _rx.clear();
+    _rxTime.clear();
+    _rxPos = 0;
+}
+
+void LoopbackStream::receive(const uint8_t* data, size_t size, double start, double byteTime) {
+    // Okunmuş bölüm ara sıra atılır, tampon sınırsız büyümez
+    // The consumed part is dropped now and then, the buffer does not grow without bound
+    if (_rxPos > 4096 && _rxPos * 2 > _rx.size()) {
+        _rx.erase(_rx.begin(), _rx.begin() + _rxPos);
+        if (!_rxTime.empty()) _rxTime.erase(_rxTime.begin(), _rxTime.begin() + _rxPos);
+        _rxPos = 0;
+    }
+    if (byteTime > 0.0 || !_rxTime.empty()) {
+        // Zamansız byte'lar (ör. inject) hemen varır ama sırayı bozmaz
+        // Untimed bytes (e.g. inject) arrive at once but keep the order
+        _rxTime.resize(_rx.size(), 0);
+        uint32_t last = _rxTime.empty() ? 0 : _rxTime.back();
+        const uint32_t now = micros();
+        for (size_t i = 0; i < size; i++) {
+            uint32_t at = (byteTime > 0.0) ? (uint32_t)(start + (i + 1) * byteTime + 0.5) : now;
+            if (at < last) at = last;
+            _rxTime.push_back(at);
+            last = at;
+        }
+    }
+    _rx.insert(_rx.end(), data, data + size);
+}
+
+uint32_t LoopbackStream::nextRandom() {
+    // xorshift32: tekrarlanabilir hata desenleri için sabit tohum
+    // xorshift32: fixed seed for repeatable error patterns
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+}
+
+// ======================== PAYLAŞILAN HAT ========================
+// ======================== SHARED BUS =============================
+BusPort::BusPort() : _bus(nullptr), _txEnd(0.0) {}
+
+size_t BusPort::write(const uint8_t* buffer, size_t size) {
+    return (_bus != nullptr) ? _bus->transmit(*this, buffer, size) : 0;
+}
+
+int BusPort::availableForWrite() {
+    return 4096;
+}
+
+SerialBus::SerialBus(uint32_t baud) : _byteTime(10.0e6 / baud), _busy(0.0), _collisions(0) {}
+
+void SerialBus::attach(BusPort& port) {
+    port._bus = this;
+    _ports.push_back(&port);
+}
+
+void SerialBus::resetCounters() {
+    _busy = 0.0;
+    _collisions = 0;
+}
+
+size_t SerialBus::transmit(BusPort& sender, const uint8_t* buffer, size_t size) {
+    // Düğümün kendi UART'ı byte'ları sırayla çıkarır // The node's own UART sends its bytes in order
+    const double start = std::max((double)hostMicros(), sender._txEnd);
+    sender._txEnd = start + size * _byteTime;
+    sender._bytesWritten += size;
+    _busy += size * _byteTime;
+
+    double othersEnd = 0.0;
+    for (BusPort* port : _ports) {
+        if (port != &sender && port->_txEnd > othersEnd) othersEnd = port->_txEnd;
+    }
+
+    std::vector<uint8_t> bytes(buffer, buffer + size);
+    if (othersEnd > start) {
+        // Çarpışma: iki tarafın üst üste binen byte'ları bozulur (alıcılarda henüz varmamış olanlar dahil)
+        // Collision: the overlapping bytes of both sides are garbled (including those not yet arrived at the receivers)
+        _collisions++;
+        for (size_t i = 0; i < size && start + i * _byteTime < othersEnd; i++) bytes[i] ^= 0x5A;
+        for (BusPort* port : _ports) {
+            if (port == &sender) continue;
+            for (size_t i = port->_rxTime.size(); i > port->_rxPos && port->_rxTime[i - 1] > start; i--) {
+                port->_rx[i - 1] ^= 0xA5;
+            }
+        }
+    }
+    for (BusPort* port : _ports) {
+        if (port != &sender) port->receive(bytes.data(), size, start, _byteTime);
+    }
+    return size;
+}
+
+// ======================== PTY ========================
+PtyStream::PtyStream() : _fd(-1), _bufferPos(0), _bufferLength(0) {
+    _slaveName[0] = 0;
+}
+
+PtyStream::~PtyStream() {
+    close();
+}
+
+bool PtyStream::openMaster() {
+    close();
+    _fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (_fd < 0) return false;
+    if (grantpt(_fd) != 0 || unlockpt(_fd) != 0 || ptsname_r(_fd, _slaveName, sizeof(_slaveName)) != 0) {
+        close();
+        return false;
+    }
+    return configure();
+}
+
+bool PtyStream::openSlave(const char* path) {
+    close();
+    _fd = ::open(path, O_RDWR | O_NOCTTY);
+    if (_fd < 0) return false;
+    return configure();
+}
+
+void PtyStream::close() {
+    if (_fd >= 0) ::close(_fd);
+    _fd = -1;
+    _bufferPos = _bufferLength = 0;
+}
+
+bool PtyStream::configure() {
+    // Ham kip: satır disiplini 0x0A/0x0D veya kontrol byte'larını değiştirmemeli
+    // Raw mode: the line discipline must not alter 0x0A/0x0D or control bytes
+    struct termios tio;
+    if (tcgetattr(_fd, &tio) != 0) return false;
+    cfmakeraw(&tio);
+    if (tcsetattr(_fd, TCSANOW, &tio) != 0) return false;
+    return fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL) | O_NONBLOCK) == 0;
+}
+
+size_t PtyStream::write(const uint8_t* buffer, size_t size) {
+    // Arduino HardwareSerial gibi tampon boşalana kadar bekler; karşı taraf okumuyorsa 100 ms sonra vazgeçer
+    // Waits for buffer space like Arduino HardwareSerial; gives up after 100 ms if the other side does not read
+    size_t written = 0;
+    while (written < size) {
+        const ssize_t result = ::write(_fd, buffer + written, size - written);
+        if (result > 0) {
+            written += result;
+            continue;
+        }
+        struct pollfd pfd = { _fd, POLLOUT, 0 };
+        if (poll(&pfd, 1, 100) != 1) break;
+    }
+    return written;
+}
+
+int PtyStream::availableForWrite() {
+    struct pollfd pfd = { _fd, POLLOUT, 0 };
+    return (poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLOUT)) ? 256 : 0;
+}
+
+int PtyStream::available() {
+    int pending = 0;
+    if (ioctl(_fd, FIONREAD, &pending) != 0) pending = 0;
+    return (int)(_bufferLength - _bufferPos) + pending;
+}
+
+int PtyStream::read() {
+    if (_bufferPos == _bufferLength && !fill()) return -1;
+    return _buffer[_bufferPos++];
+}
+
+bool PtyStream::fill() {
+    // Byte başına sistem çağrısı yerine blok okuma
+    // Block read instead of a system call per byte
+    const ssize_t result = ::read(_fd, _buffer, sizeof(_buffer));
+    if (result <= 0) return false;
+    _bufferPos = 0;
+    _bufferLength = result;
+    return true;
+}
+
+// ======================== DOSYA ========================
+// ======================== FILE =========================
+FileStream::FileStream() : _file(nullptr) {
+}
+
+FileStream::~FileStream() {
+    close();
+}
+
+bool FileStream::open(const char* path, bool append) {
+    close();
+    _file = fopen(path, append ? "ab" : "wb");
+    return _file != nullptr;
+}
+
+void FileStream::close() {
+    if (_file != nullptr) fclose(_file);
+    _file = nullptr;
+}
+
+void FileStream::flush() {
+    if (_file != nullptr) fflush(_file);
+}
+
+size_t FileStream::write(const uint8_t* buffer, size_t size) {
+    return (_file != nullptr) ? fwrite_unlocked(buffer, 1, size, _file) : 0;
+}
+
+int FileStream::availableForWrite() {
+    return (_file != nullptr) ? 4096 : 0;
+}
@@ -0,0 +1,217 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Host Support
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Linux/PC support for building and measuring StarDust off-target: millis()/micros()
+backed by the monotonic clock, an in-memory LoopbackStream with optional bit-error
+injection, a PtyStream that talks through a pseudo terminal like a real UART and a
+FileStream for capture logs.
+Not part of the Arduino library; see CMakeLists.txt at the repository root.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_HOST_H
+#define STARDUST_HOST_H
+
+#include "StarDust.h"
+#include <stdio.h>
+#include <vector>
+
+uint32_t micros();
+
+// Elle ilerletilen saat: zamanlayıcıya bağlı katmanlar (yeniden gönderim, zaman aşımı) tekrarlanabilir biçimde ölçülür
+// Manually advanced clock: timer driven layers (retransmission, timeouts) are measured repeatably
+class HostClock {
+public:
+    static void setManual(bool manual);   // true: millis()/micros() yalnızca advance() ile ilerler // true: millis()/micros() only move with advance()
+    static void advance(uint32_t us);
+};
+
+/* ======================================================= */
+/* ================ BELLEK İÇİ STREAM =====================*/
+/* ================ IN-MEMORY STREAM ======================*/
+/* ======================================================= */
+// Tek başına kullanıldığında yazılan byte'lar aynı nesneden geri okunur.
+// connect() ile iki nesne çapraz bağlanır: birinin yazdığı diğerinden okunur.
+// Used alone, written bytes are read back from the same object.
+// connect() cross-links two objects: what one writes, the other reads.
+class LoopbackStream : public Stream {
+public:
+    LoopbackStream();
+
+    void connect(LoopbackStream& peer);
+
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int availableForWrite() override;
+    int available() override;
+    int read() override;
+
+    // Yazılan her bit bu olasılıkla ters çevrilir (0 = hatasız hat)
+    // Every written bit is flipped with this probability (0 = error-free line)
+    void setBitErrorRate(double rate, uint32_t seed = 1);
+    // Hatta gürültü: byte'lar hata eklenmeden karşı tarafa verilir
+    // Noise on the line: bytes are handed to the other side without error injection
+    void inject(const uint8_t* data, size_t size);
+    // 0 = sınırsız; aksi halde availableForWrite() bu değeri bildirir
+    // 0 = unlimited; otherwise availableForWrite() reports this value
+    void setWriteWindow(int bytes);
+    // 0 = anında teslim; aksi halde bu yöndeki hat 8N1 hızında çalışır, byte'lar micros()'a göre varır
+    // ve availableForWrite() UART gönderim tamponunu (txBuffer byte) taklit eder
+    // 0 = instant delivery; otherwise this direction runs at this 8N1 rate, bytes arrive by micros()
+    // and availableForWrite() mimics the UART transmit buffer (txBuffer bytes)
+    void setBaudRate(uint32_t baud, int txBuffer = 128);
+
+    size_t readBytes(uint8_t* out, size_t size);
+    void clear();
+    uint64_t bytesWritten() const { return _bytesWritten; }
+    uint64_t bitsFlipped() const { return _bitsFlipped; }
+
+private:
+    friend class SerialBus;
+
+    LoopbackStream* _peer;
+    std::vector<uint8_t> _rx;
+    std::vector<uint32_t> _rxTime; // Byte'ların varış anı (yalnızca hız sınırlı hatta) // Arrival time of the bytes (rate limited line only)
+    size_t _rxPos;
+    double _bitErrorRate;
+    uint32_t _seed;
+    int _writeWindow;
+    uint64_t _bytesWritten;
+    uint64_t _bitsFlipped;
+    double _byteTime;  // µs
+    double _lineFree;  // µs
+    int _txBuffer;
+
+    void receive(const uint8_t* data, size_t size, double start = 0.0, double byteTime = 0.0);
+    size_t arrived();
+    uint32_t nextRandom();
+};
+
+/* ======================================================= */
+/* ================= PAYLAŞILAN HAT =======================*/
+/* ================= SHARED BUS ===========================*/
+/* ======================================================= */
+// RS-485 gibi yarı çift yönlü çok noktalı hat: bir düğümün yazdığı diğer tüm düğümlere gider.
+// Zamanda çakışan iki yazmada üst üste binen byte'lar bozulur ve çarpışma sayılır (byte zamanları micros()'a göre).
+// Half-duplex multi-drop line like RS-485: what one node writes goes to every other node.
+// When two writes overlap in time, the overlapping bytes are garbled and a collision is counted (byte times follow micros()).
+class SerialBus;
+
+class BusPort : public LoopbackStream {
+public:
+    BusPort();
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int availableForWrite() override;
+
+private:
+    friend class SerialBus;
+    SerialBus* _bus;
+    double _txEnd;     // Bu düğümün son byte'ının hattan çıktığı an (µs) // When this node's last byte leaves the line (µs)
+};
+
+class SerialBus {
+public:
+    explicit SerialBus(uint32_t baud);
+
+    void attach(BusPort& port);
+    uint64_t collisions() const { return _collisions; }
+    double busyMicros() const { return _busy; }     // Hattın dolu olduğu toplam süre // Total time the line was driven
+    void resetCounters();
+
+private:
+    friend class BusPort;
+    std::vector<BusPort*> _ports;
+    double _byteTime;  // µs
+    double _busy;
+    uint64_t _collisions;
+
+    size_t transmit(BusPort& sender, const uint8_t* buffer, size_t size);
+};
+
+/* ======================================================= */
+/* ================= PTY TABANLI STREAM ===================*/
+/* ================= PTY BACKED STREAM ====================*/
+/* ======================================================= */
+// Gerçek bir seri port gibi çekirdek üzerinden geçer: read/write sistem çağrıları ve tamponlama dahil ölçülür.
+// Goes through the kernel like a real serial port: read/write system calls and buffering are part of the measurement.
+class PtyStream : public Stream {
+public:
+    PtyStream();
+    ~PtyStream();
+
+    bool openMaster();                   // Yeni bir pty çifti açar // Opens a new pty pair
+    bool openSlave(const char* path);    // Ana tarafın slaveName() yolunu açar // Opens the slaveName() path of the master side
+    void close();
+    const char* slaveName() const { return _slaveName; }
+    int fd() const { return _fd; }
+
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int availableForWrite() override;
+    int available() override;
+    int read() override;
+
+private:
+    int _fd;
+    char _slaveName[64];
+    uint8_t _buffer[256];
+    size_t _bufferPos;
+    size_t _bufferLength;
+
+    bool configure();
+    bool fill();
+};
+
+/* ======================================================= */
+/* ================ DOSYA STREAM'İ ========================*/
+/* ================ FILE STREAM ===========================*/
+/* ======================================================= */
+// Yalnızca yazma, stdio tamponlu: StarDustLogWriter yakalamaları için (SD kart File nesnesinin PC karşılığı)
+// Write only, stdio buffered: for StarDustLogWriter captures (the PC counterpart of an SD card File)
+class FileStream : public Stream {
+public:
+    FileStream();
+    ~FileStream();
+
+    bool open(const char* path, bool append = false);
+    void close();
+    void flush();
+
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int availableForWrite() override;
+
+private:
+    FILE* _file;
+};
+
+#endif
@@ -0,0 +1,138 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Log Cat
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Prints the frames of a StarDustLog capture or of a raw line dump, one line per frame:
+time, link, recorded result, source > target, type, size, CRC check and payload in hex.
+
+  stardust_logcat [-s id] [-t id] [-y type] [-l link] [-k key] [-p id:key] [-v] [-c] [-q] file
+
+  -s, -t, -y, -l  match source, target, packet type (number) or link; may be repeated
+  -k              shared key, 32 hex digits (default: the library default key)
+  -p              peer key as id:32 hex digits; may be repeated
+  -v              only frames passing the CRC
+  -c              raw dump with COBS framing (a log file names its framing itself)
+  -q              summary only
+
+*/
+
+#include "StarDustLogReader.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static const char* resultName(CaptureResult result) {
+    switch (result) {
+        case CaptureResult::VALID: return "ok";
+        case CaptureResult::CRC_ERROR: return "crc";
+        case CaptureResult::MALFORMED: return "malformed";
+        case CaptureResult::FOREIGN: return "foreign";
+        case CaptureResult::TIMEOUT: return "timeout";
+    }
+    return "?";
+}
+
+static bool parseKey(const char* text, uint8_t* key) {
+    for (uint8_t i = 0; i < StarDustCipher::KEY_SIZE; i++) {
+        unsigned value;
+        if (sscanf(text + 2 * i, "%2x", &value) != 1) return false;
+        key[i] = (uint8_t)value;
+    }
+    return text[2 * StarDustCipher::KEY_SIZE] == '\0';
+}
+
+static void printFrame(const StarDustLogReader::Frame& frame, void*) {
+    const PacketHeader& header = frame.packet.header;
+    printf("%12.6f %3u %-9s %3u > %3u type %3u size %2u %s ", frame.time * 1e-6, frame.link, resultName(frame.recorded),
+           header.source, header.target, (unsigned)header.type, header.size, frame.valid ? "crc-ok " : "crc-bad");
+    const uint8_t size = (header.size <= PAYLOADSIZE) ? header.size : 0;
+    for (uint8_t i = 0; i < size; i++) printf("%02x", frame.packet.payload[i]);
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    StarDustLogReader reader;
+    bool quiet = false;
+    bool cobs = false;
+    uint8_t key[StarDustCipher::KEY_SIZE];
+    int option;
+    while ((option = getopt(argc, argv, "s:t:y:l:k:p:vcq")) != -1) {
+        switch (option) {
+            case 's': reader.matchSource((uint8_t)strtoul(optarg, nullptr, 0)); break;
+            case 't': reader.matchTarget((uint8_t)strtoul(optarg, nullptr, 0)); break;
+            case 'y': reader.matchType((PacketType)strtoul(optarg, nullptr, 0)); break;
+            case 'l': reader.matchLink((uint8_t)strtoul(optarg, nullptr, 0)); break;
+            case 'k':
+                if (!parseKey(optarg, key)) {
+                    fprintf(stderr, "bad key: %s\n", optarg);
+                    return 2;
+                }
+                reader.setCryptoKey(key);
+                break;
+            case 'p': {
+                char* rest = nullptr;
+                const uint8_t id = (uint8_t)strtoul(optarg, &rest, 0);
+                if (rest == nullptr || *rest != ':' || !parseKey(rest + 1, key)) {
+                    fprintf(stderr, "bad peer key: %s\n", optarg);
+                    return 2;
+                }
+                reader.setPeerKey(id, key);
+                break;
+            }
+            case 'v': reader.validOnly(true); break;
+            case 'c': cobs = true; break;
+            case 'q': quiet = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-s id] [-t id] [-y type] [-l link] [-k key] [-p id:key] [-v] [-c] [-q] file\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [options] file\n", argv[0]);
+        return 2;
+    }
+    if (!reader.open(argv[optind])) {
+        fprintf(stderr, "cannot open %s (or log from another PAYLOADSIZE)\n", argv[optind]);
+        return 1;
+    }
+    if (cobs) reader.setRawFraming(STARDUST_FRAMING_COBS);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const uint64_t matched = reader.scan(quiet ? nullptr : &printFrame);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const StarDustLogReader::Stats& stats = reader.stats();
+    fprintf(stderr, "%s, %s framing: %llu bytes, %llu %s, %llu decoded, %llu crc errors, %llu matched, %llu damaged bytes, %.0f MB/s\n",
+            reader.isLog() ? "log" : "raw dump", reader.framing() == STARDUST_FRAMING_COBS ? "COBS" : "start byte",
+            (unsigned long long)stats.bytes, (unsigned long long)stats.records, reader.isLog() ? "records" : "candidates",
+            (unsigned long long)stats.decoded, (unsigned long long)stats.crcErrors, (unsigned long long)matched,
+            (unsigned long long)stats.damaged, stats.bytes / elapsed / 1e6);
+    return 0;
+}
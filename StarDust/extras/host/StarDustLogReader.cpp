@@ -0,0 +1,407 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Capture Log Reader
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustLogReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Başlıksız ham dökümde varsayılan anahtar (StarDust.cpp ile aynı) // Default key for a raw dump (same as StarDust.cpp)
+static const uint8_t DEFAULT_KEY[16] = {
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16
+};
+
+// Kayıttaki çerçevenin olabilecek en uzun hali (her iki çerçevelemede) // Longest frame a record may hold (either framing)
+static const size_t LOG_FRAME_MAX = sizeof(PacketData) + 2;
+// Okuyucu iki çerçevelemeyi de çözer; STARDUST_COBS_DELIMITER yalnızca COBS derlemesinde var
+// The reader decodes both framings; STARDUST_COBS_DELIMITER only exists in a COBS build
+static const uint8_t COBS_DELIMITER = 0x00;
+
+StarDustLogReader::StarDustLogReader() {
+    _data = nullptr;
+    _size = 0;
+    _mapped = 0;
+    _isLog = false;
+    _framing = STARDUST_FRAMING;
+    _variableFrames = STARDUST_VARIABLE_FRAMES;
+    StarDustCipher::expand(_cipher, DEFAULT_KEY);
+    memset(_hasPeerKey, 0, sizeof(_hasPeerKey));
+    _validOnly = false;
+    clearMatch();
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+StarDustLogReader::~StarDustLogReader() {
+    close();
+}
+
+bool StarDustLogReader::open(const char* path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Eşleme dosya kapansa da geçerli kalır // The mapping stays valid after the file is closed
+    if (map == MAP_FAILED) return false;
+    // Baştan sona tek geçiş: çekirdek önden okur, okunan sayfalar erken bırakılabilir
+    // One pass front to back: the kernel reads ahead and may drop pages early
+    madvise(map, info.st_size, MADV_SEQUENTIAL);
+    _mapped = info.st_size;
+    return open((const uint8_t*)map, info.st_size);
+}
+
+bool StarDustLogReader::open(const uint8_t* data, size_t size) {
+    _data = data;
+    _size = size;
+    const StarDustLogHeader* header = (const StarDustLogHeader*)data;
+    _isLog = size >= sizeof(StarDustLogHeader) && memcmp(header->magic, STARDUST_LOG_MAGIC, sizeof(header->magic)) == 0;
+    if (_isLog) {
+        // Farklı PAYLOADSIZE ile derlenmiş bir düğümün kaydı bu yapılarla çözülemez
+        // A capture from a node built with another PAYLOADSIZE cannot be decoded with these structs
+        if (header->version != STARDUST_LOG_VERSION || header->payloadSize != PAYLOADSIZE) {
+            close();
+            return false;
+        }
+        _framing = header->framing;
+        _variableFrames = (header->flags & STARDUST_LOG_VARIABLE_FRAMES) != 0;
+    }
+    return true;
+}
+
+void StarDustLogReader::close() {
+    if (_mapped > 0) munmap((void*)_data, _mapped);
+    _data = nullptr;
+    _size = 0;
+    _mapped = 0;
+    _isLog = false;
+}
+
+void StarDustLogReader::setRawFraming(uint8_t framing) {
+    if (!_isLog) _framing = framing;
+}
+
+void StarDustLogReader::setCryptoKey(const uint8_t* key) {
+    StarDustCipher::expand(_cipher, key);
+}
+
+void StarDustLogReader::setPeerKey(uint8_t peerID, const uint8_t* key) {
+    _hasPeerKey[peerID] = (key != nullptr);
+    if (key != nullptr) StarDustCipher::expand(_peerKeys[peerID], key);
+}
+
+void StarDustLogReader::matchSource(uint8_t id) {
+    add(_sources, id);
+    _anySource = false;
+}
+
+void StarDustLogReader::matchTarget(uint8_t id) {
+    add(_targets, id);
+    _anyTarget = false;
+}
+
+void StarDustLogReader::matchType(PacketType type) {
+    add(_types, type);
+    _anyType = false;
+}
+
+void StarDustLogReader::matchLink(uint8_t link) {
+    add(_links, link);
+    _anyLink = false;
+}
+
+void StarDustLogReader::validOnly(bool enabled) {
+    _validOnly = enabled;
+}
+
+void StarDustLogReader::clearMatch() {
+    memset(_sources, 0, sizeof(_sources));
+    memset(_targets, 0, sizeof(_targets));
+    memset(_types, 0, sizeof(_types));
+    memset(_links, 0, sizeof(_links));
+    _anySource = true;
+    _anyTarget = true;
+    _anyType = true;
+    _anyLink = true;
+}
+
+// ======================== ÇÖZME ========================
+// ======================== DECODING =====================
+size_t StarDustLogReader::cobsDecode(const uint8_t* in, size_t length, uint8_t* out, size_t capacity) {
+    // Bloklar memcpy ile kopyalanır; ayraç veya kapasite çözmeyi bitirir
+    // Blocks are copied with memcpy; a delimiter or the capacity ends decoding
+    size_t used = 0;
+    size_t written = 0;
+    while (used < length) {
+        const uint8_t code = in[used++];
+        if (code == 0) break;
+        size_t run = code - 1;
+        if (run > length - used) run = length - used;
+        if (run > capacity - written) run = capacity - written;
+        const uint8_t* zero = (const uint8_t*)memchr(in + used, 0, run);
+        if (zero != nullptr) run = zero - (in + used);
+        memcpy(out + written, in + used, run);
+        used += run;
+        written += run;
+        if (zero != nullptr || written == capacity) break;
+        if (code != 0xFF && used < length) out[written++] = 0;
+    }
+    return written;
+}
+
+size_t StarDustLogReader::frameLength(const PacketHeader& header) const {
+    return sizeof(PacketHeader) + (_variableFrames ? header.size : PAYLOADSIZE) + sizeof(uint16_t);
+}
+
+bool StarDustLogReader::headerMatches(const PacketHeader& header) const {
+    if (!_anySource && !has(_sources, header.source)) return false;
+    if (!_anyTarget && !has(_targets, header.target)) return false;
+    // AGGREGATE kayıtlarına çözüldükten sonra bakılır // AGGREGATE records are looked at after decoding
+    return _anyType || header.type == AGGREGATE || has(_types, header.type);
+}
+
+bool StarDustLogReader::typeMatches(const PacketData& packet) const {
+    if (_anyType || has(_types, packet.header.type)) return true;
+    if (packet.header.type != AGGREGATE) return false;
+    uint8_t pos = 0;
+    while (pos + 2 <= packet.header.size) {
+        const uint8_t type = packet.payload[pos];
+        const uint8_t size = packet.payload[pos + 1];
+        if (size > packet.header.size - pos - 2) break;
+        if (has(_types, type)) return true;
+        pos += 2 + size;
+    }
+    return false;
+}
+
+bool StarDustLogReader::decode(const uint8_t* wire, size_t length, Frame& frame) {
+    // Çerçevelemeden arındırılmış çerçeve: başlık, şifreli payload, CRC // Frame without framing: header, encrypted payload, CRC
+    uint8_t buffer[LOG_FRAME_MAX];
+    const uint8_t* plain = wire;
+    if (_framing == STARDUST_FRAMING_COBS) {
+        if (length < 1 || wire[0] != COBS_DELIMITER) return false;
+        // Önce yalnızca başlık çözülür: süzgeçten geçmeyen çerçevenin geri kalanına dokunulmaz
+        // Only the header is decoded first: the rest of a frame failing the filters is not touched
+        if (cobsDecode(wire + 1, length - 1, buffer, sizeof(PacketHeader)) == sizeof(PacketHeader) &&
+            buffer[0] == PACKET_START_BYTE && !headerMatches(*(const PacketHeader*)buffer)) return false;
+        length = cobsDecode(wire + 1, length - 1, buffer, sizeof(buffer));
+        plain = buffer;
+    }
+    if (length < sizeof(PacketHeader) || plain[0] != PACKET_START_BYTE) {
+        // Başlığı bile olmayan kırıntılar yalnızca süzgeçsiz dökümde görünür // Scraps without a header only show up in an unfiltered dump
+        if (_validOnly || !_anySource || !_anyTarget || !_anyType) return false;
+        memset(&frame.packet, 0, sizeof(frame.packet));
+        frame.valid = false;
+        return true;
+    }
+
+    const PacketHeader& header = *(const PacketHeader*)plain;
+    if (!headerMatches(header)) return false;
+    _stats.decoded++;
+
+    memcpy(&frame.packet.header, &header, sizeof(PacketHeader));
+    frame.valid = false;
+    const size_t wireSize = (_variableFrames || header.size > PAYLOADSIZE) ? header.size : PAYLOADSIZE;
+    if (header.size > PAYLOADSIZE || length < sizeof(PacketHeader) + wireSize + sizeof(uint16_t)) {
+        // Bozuk başlık veya yarım çerçeve: yalnızca başlık verilir // Broken header or partial frame: only the header is given
+        memset(frame.packet.payload, 0, sizeof(frame.packet.payload));
+        frame.packet.crc = 0;
+        return !_validOnly && _anyType;
+    }
+
+    uint8_t* payload = frame.packet.payload;
+    memcpy(payload, plain + sizeof(PacketHeader), wireSize);
+    memset(payload + wireSize, 0, PAYLOADSIZE - wireSize);
+    memcpy(&frame.packet.crc, plain + sizeof(PacketHeader) + wireSize, sizeof(uint16_t));
+
+    const StarDustCipher::Schedule& key = _hasPeerKey[header.source] ? _peerKeys[header.source]
+                                        : _hasPeerKey[header.target] ? _peerKeys[header.target] : _cipher;
+    StarDustCipher::decrypt(key, payload, wireSize);
+    // CRC düz metin üzerinden (bkz. StarDust::buildFrame) // The CRC covers the plaintext (see StarDust::buildFrame)
+    uint16_t crc = StarDustCRC::update(StarDustCRC::INIT, plain, sizeof(PacketHeader));
+    crc = StarDustCRC::update(crc, payload, wireSize);
+    frame.valid = (crc == frame.packet.crc);
+    if (!frame.valid) {
+        _stats.crcErrors++;
+        return !_validOnly && _anyType;
+    }
+    return typeMatches(frame.packet);
+}
+
+void StarDustLogReader::deliver(Frame& frame, FrameHandler handler, void* context) {
+    _stats.matched++;
+    if (handler != nullptr) handler(frame, context);
+}
+
+// ======================== TARAMA ========================
+// ======================== SCANNING ======================
+uint64_t StarDustLogReader::scan(FrameHandler handler, void* context) {
+    memset(&_stats, 0, sizeof(_stats));
+    if (_data == nullptr) return 0;
+    if (_isLog) return scanLog(handler, context);
+    return (_framing == STARDUST_FRAMING_COBS) ? scanCobs(handler, context) : scanRaw(handler, context);
+}
+
+uint64_t StarDustLogReader::scanLog(FrameHandler handler, void* context) {
+    const uint8_t frameStart = (_framing == STARDUST_FRAMING_COBS) ? COBS_DELIMITER : PACKET_START_BYTE;
+    const uint8_t* const end = _data + _size;
+    const uint8_t* p = _data + sizeof(StarDustLogHeader);
+    uint64_t epoch = 0;
+    uint32_t last = 0;
+    Frame frame;
+
+    while (end - p >= (ptrdiff_t)sizeof(StarDustLogRecord)) {
+        StarDustLogRecord record;
+        memcpy(&record, p, sizeof(record));
+        const uint8_t* wire = p + sizeof(StarDustLogRecord);
+        const uint8_t* next = wire + record.length;
+        // Kayıt sağlam görünmeli ve ardından ya dosya sonu ya da yeni kayıt gelmeli
+        // The record must look sound and be followed by either the end of the file or a new record
+        const bool sound = record.sync == STARDUST_LOG_SYNC && record.length > 0 && record.length <= LOG_FRAME_MAX &&
+                           record.result <= (uint8_t)CaptureResult::TIMEOUT && next <= end && wire[0] == frameStart &&
+                           (next == end || next[0] == STARDUST_LOG_SYNC);
+        if (!sound) {
+            // Yarım yazılmış kayıt: sıradaki senkron byte'ı aranır // Partially written record: look for the next sync byte
+            const uint8_t* sync = (const uint8_t*)memchr(p + 1, STARDUST_LOG_SYNC, end - p - 1);
+            const uint8_t* resume = (sync != nullptr) ? sync : end;
+            _stats.damaged += resume - p;
+            p = resume;
+            continue;
+        }
+        _stats.records++;
+        p = next;
+
+        // Zaman damgası 32 bit döner; kayıtlar zaman sırasıyla yazıldığı için geri gidiş bir dönüştür
+        // The timestamp wraps at 32 bits; records are written in time order, so a step back is a wrap
+        if (record.time < last) epoch += (uint64_t)1 << 32;
+        last = record.time;
+
+        if (!_anyLink && !has(_links, record.link)) continue;
+        if (!decode(wire, record.length, frame)) continue;
+        frame.time = epoch + record.time;
+        frame.offset = wire - _data;
+        frame.wire = wire;
+        frame.wireLength = record.length;
+        frame.link = record.link;
+        frame.recorded = (CaptureResult)record.result;
+        deliver(frame, handler, context);
+    }
+    _stats.bytes = _size;
+    return _stats.matched;
+}
+
+uint64_t StarDustLogReader::scanRaw(FrameHandler handler, void* context) {
+    // Başlangıç byte'ları memchr ile bulunur (glibc'de vektörel); her aday başlık, süzgeç ve CRC ile sınanır.
+    // Geçerli çerçevenin tamamı atlanır, reddedilen adayda bir byte ilerlenir (StarDust::resync gibi).
+    // Start bytes are found with memchr (vectorised in glibc); every candidate is tried with header, filter and CRC.
+    // A valid frame is skipped as a whole, a rejected candidate moves on by one byte (like StarDust::resync).
+    const uint8_t* const end = _data + _size;
+    const uint8_t* p = _data;
+    Frame frame;
+    const bool validOnly = _validOnly;
+    _validOnly = true; // Hamda geçersiz adaylar çerçeve değildir // In a raw dump invalid candidates are not frames
+    while ((p = (const uint8_t*)memchr(p, PACKET_START_BYTE, end - p)) != nullptr) {
+        _stats.records++;
+        const PacketHeader& header = *(const PacketHeader*)p;
+        if (end - p < (ptrdiff_t)sizeof(PacketHeader) || header.size > PAYLOADSIZE) {
+            p++;
+            continue;
+        }
+        const size_t length = frameLength(header);
+        if ((size_t)(end - p) < length || !decode(p, length, frame)) {
+            p++;
+            continue;
+        }
+        frame.time = 0;
+        frame.offset = p - _data;
+        frame.wire = p;
+        frame.wireLength = length;
+        frame.link = 0;
+        frame.recorded = CaptureResult::VALID;
+        deliver(frame, handler, context);
+        p += length;
+    }
+    _validOnly = validOnly;
+    _stats.bytes = _size;
+    return _stats.matched;
+}
+
+uint64_t StarDustLogReader::scanCobs(FrameHandler handler, void* context) {
+    // COBS'ta ayraçlar arası tam olarak bir çerçevedir; yeniden tarama gerekmez
+    // With COBS the span between delimiters is exactly one frame; no rescan is needed
+    const uint8_t* const end = _data + _size;
+    const uint8_t* p = (const uint8_t*)memchr(_data, COBS_DELIMITER, _size);
+    Frame frame;
+    const bool validOnly = _validOnly;
+    _validOnly = true;
+    while (p != nullptr) {
+        const uint8_t* next = (const uint8_t*)memchr(p + 1, COBS_DELIMITER, end - p - 1);
+        const uint8_t* stop = (next != nullptr) ? next : end;
+        _stats.records++;
+        const size_t length = stop - p;
+        if (length <= LOG_FRAME_MAX && decode(p, length, frame)) {
+            frame.time = 0;
+            frame.offset = p - _data;
+            frame.wire = p;
+            frame.wireLength = length;
+            frame.link = 0;
+            frame.recorded = CaptureResult::VALID;
+            deliver(frame, handler, context);
+        }
+        p = next;
+    }
+    _validOnly = validOnly;
+    _stats.bytes = _size;
+    return _stats.matched;
+}
+
+// ======================== YENİDEN OYNATMA ========================
+// ======================== REPLAY =================================
+static_assert(STARDUST_FEED_BUFFER_SIZE > 0, "StarDustLogReader::replay() uses feed(), STARDUST_FEED_BUFFER_SIZE must not be 0");
+
+static void replayFrame(const StarDustLogReader::Frame& frame, void* context) {
+    StarDustCore& node = *static_cast<StarDustCore*>(context);
+    size_t fed = 0;
+    while (fed < frame.wireLength) {
+        fed += node.feed(frame.wire + fed, frame.wireLength - fed);
+        if (fed < frame.wireLength) node.dispatch(); // Halka dolu: önce ayrıştır // Ring full: parse first
+    }
+    node.dispatch();
+}
+
+uint64_t StarDustLogReader::replay(StarDustCore& node) {
+    return scan(&replayFrame, &node);
+}
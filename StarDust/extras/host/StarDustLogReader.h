@@ -0,0 +1,151 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Capture Log Reader
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Offline decoder for StarDustLog captures and for raw byte dumps of a line (e.g. taken
+with cat from a tty). The file is memory mapped and read front to back: log records are
+stepped through by their length, raw dumps are searched for start bytes or COBS
+delimiters with memchr. Source, target, type and link filters look only at the plain
+header, so rejected frames cost neither decryption nor CRC. Frames that pass are
+decrypted and their CRC checked. Both framings are handled. Not part of the Arduino library.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_LOG_READER_H
+#define STARDUST_LOG_READER_H
+
+#include "StarDustLog.h"
+
+class StarDustLogReader {
+public:
+    struct Frame {
+        uint64_t time;            // µs, dönüşler açılmış (ham dökümde 0) // µs, wraps unrolled (0 in a raw dump)
+        uint64_t offset;          // Çerçevenin dosyadaki konumu // Position of the frame in the file
+        const uint8_t* wire;      // Hattaki byte'lar, eşlenmiş dosyanın içinde // Wire bytes, inside the mapped file
+        uint8_t wireLength;
+        uint8_t link;
+        CaptureResult recorded;   // Kayıttaki sonuç (ham dökümde CRC'den) // Result in the record (from the CRC in a raw dump)
+        bool valid;               // Okuyucunun CRC kontrolü // CRC check of the reader
+        PacketData packet;        // Çözülmüş; header.size ötesi sıfır // Decrypted; zero beyond header.size
+    };
+
+    struct Stats {
+        uint64_t bytes;           // Taranan byte'lar // Bytes scanned
+        uint64_t records;         // Log kayıtları veya ham dökümdeki adaylar // Log records or candidates in a raw dump
+        uint64_t decoded;         // Süzgeçten geçip çözülen çerçeveler // Frames that passed the filters and were decoded
+        uint64_t crcErrors;
+        uint64_t matched;         // İşleyiciye verilen // Handed to the handler
+        uint64_t damaged;         // Bozuk kayıt yüzünden atlanan byte'lar // Bytes skipped because of damaged records
+    };
+
+    typedef void (*FrameHandler)(const Frame& frame, void* context);
+
+    StarDustLogReader();
+    ~StarDustLogReader();
+
+    // Başlığı olmayan dosya ham hat dökümü olarak okunur (çerçeveleme setRawFraming() ile)
+    // A file without the header is read as a raw line dump (framing from setRawFraming())
+    bool open(const char* path);
+    bool open(const uint8_t* data, size_t size); // Bellekteki veri, kopyalanmaz // Data in memory, not copied
+    void close();
+    bool isLog() const { return _isLog; }
+    uint8_t framing() const { return _framing; }
+    void setRawFraming(uint8_t framing);
+
+    void setCryptoKey(const uint8_t* key);
+    // Çerçeve önce kaynak, sonra hedef ID'nin anahtarıyla çözülür, ikisi de yoksa ortak anahtarla
+    // A frame is decrypted with the key of its source ID, then of its target ID, else with the shared key
+    void setPeerKey(uint8_t peerID, const uint8_t* key);
+
+    // Süzgeçler birikir; bir alan için hiç değer verilmemişse o alan süzülmez. Tip süzgeci AGGREGATE
+    // çerçevelerinin kayıtlarına da bakar.
+    // Filters add up; a field with no value given is not filtered. The type filter also looks into
+    // the records of AGGREGATE frames.
+    void matchSource(uint8_t id);
+    void matchTarget(uint8_t id);
+    void matchType(PacketType type);
+    void matchLink(uint8_t link);
+    void validOnly(bool enabled);             // CRC'yi geçemeyenleri verme // Leave out frames failing the CRC
+    void clearMatch();
+
+    // Eşleşen çerçeveleri dosya sırasıyla verir, eşleşen sayısını döndürür
+    // Hands over the matching frames in file order, returns the number matched
+    uint64_t scan(FrameHandler handler, void* context = nullptr);
+    // Eşleşen çerçevelerin hattaki byte'larını node.feed() ve node.dispatch() ile ayrıştırıcıdan geçirir.
+    // Anahtarlar ve adres süzgeci node üzerinde ayarlanır (tümü için AddressFilter::PROMISCUOUS).
+    // Puts the wire bytes of the matching frames through the parser with node.feed() and node.dispatch().
+    // Keys and the address filter are set on node (AddressFilter::PROMISCUOUS for everything).
+    uint64_t replay(StarDustCore& node);
+
+    const Stats& stats() const { return _stats; }
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _mapped;           // munmap için; 0 = eşleme bizim değil // For munmap; 0 = not our mapping
+    bool _isLog;
+    uint8_t _framing;
+    bool _variableFrames;
+
+    StarDustCipher::Schedule _cipher;
+    StarDustCipher::Schedule _peerKeys[256];
+    bool _hasPeerKey[256];
+
+    uint8_t _sources[32];     // 256 bitlik kümeler // 256-bit sets
+    uint8_t _targets[32];
+    uint8_t _types[32];
+    uint8_t _links[32];
+    bool _anySource;
+    bool _anyTarget;
+    bool _anyType;
+    bool _anyLink;
+    bool _validOnly;
+
+    Stats _stats;
+
+    static bool has(const uint8_t* set, uint8_t value) { return (set[value >> 3] >> (value & 7)) & 1; }
+    static void add(uint8_t* set, uint8_t value) { set[value >> 3] |= (uint8_t)(1 << (value & 7)); }
+    static size_t cobsDecode(const uint8_t* in, size_t length, uint8_t* out, size_t capacity);
+
+    size_t frameLength(const PacketHeader& header) const;
+    bool headerMatches(const PacketHeader& header) const;
+    bool typeMatches(const PacketData& packet) const;
+    bool decode(const uint8_t* wire, size_t length, Frame& frame);
+    uint64_t scanLog(FrameHandler handler, void* context);
+    uint64_t scanRaw(FrameHandler handler, void* context);
+    uint64_t scanCobs(FrameHandler handler, void* context);
+    void deliver(Frame& frame, FrameHandler handler, void* context);
+};
+
+#endif
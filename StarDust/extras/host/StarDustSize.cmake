@@ -0,0 +1,64 @@
+# StarDust boyut raporu: CMakeLists.txt'teki stardust_size hedefi çalıştırır
+# StarDust size report: run by the stardust_size target in CMakeLists.txt
+#
+#   cmake -DSIZE_TOOL=size -DSIZE_DIR=<dir> -DSIZE_CONFIGS="a;b" -DSIZE_TITLE=... -P StarDustSize.cmake
+#
+# <dir>/<config>/ altında kütüphane nesneleri ve StarDustSizeProbe.o beklenir.
+# flash      = kütüphane nesnelerinin text + data toplamı (--gc-sections öncesi, üst sınır)
+# static RAM = kütüphane nesnelerinin data + bss toplamı (bağlantı sayısından bağımsız)
+# RAM/link   = StarDustSizeProbe.o'nun bss'i, yani bir StarDust nesnesi
+# Expects the library objects and StarDustSizeProbe.o under <dir>/<config>/.
+# flash      = text + data of the library objects (before --gc-sections, an upper bound)
+# static RAM = data + bss of the library objects (independent of the number of links)
+# RAM/link   = bss of StarDustSizeProbe.o, i.e. one StarDust object
+
+function(stardust_size_of files out_text out_data out_bss)
+    execute_process(COMMAND ${SIZE_TOOL} -B ${files} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${SIZE_TOOL} failed on ${files}")
+    endif()
+    set(text 0)
+    set(data 0)
+    set(bss 0)
+    string(REPLACE "\n" ";" lines "${output}")
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]")
+            math(EXPR text "${text} + ${CMAKE_MATCH_1}")
+            math(EXPR data "${data} + ${CMAKE_MATCH_2}")
+            math(EXPR bss "${bss} + ${CMAKE_MATCH_3}")
+        endif()
+    endforeach()
+    set(${out_text} ${text} PARENT_SCOPE)
+    set(${out_data} ${data} PARENT_SCOPE)
+    set(${out_bss} ${bss} PARENT_SCOPE)
+endfunction()
+
+function(stardust_pad text width out)
+    string(LENGTH "${text}" length)
+    while(length LESS width)
+        set(text " ${text}")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+set(report "StarDust size report (${SIZE_TITLE})\n")
+string(APPEND report "config           flash  static RAM  RAM/link\n")
+foreach(config IN LISTS SIZE_CONFIGS)
+    file(GLOB objects ${SIZE_DIR}/${config}/*.o)
+    list(FILTER objects EXCLUDE REGEX "StarDustSizeProbe\\.o$")
+    stardust_size_of("${objects}" text data bss)
+    stardust_size_of("${SIZE_DIR}/${config}/StarDustSizeProbe.o" probe_text probe_data probe_bss)
+    math(EXPR flash "${text} + ${data}")
+    math(EXPR ram "${data} + ${bss}")
+
+    set(name "${config}                ")
+    string(SUBSTRING "${name}" 0 14 name)
+    stardust_pad(${flash} 7 flash)
+    stardust_pad(${ram} 12 ram)
+    stardust_pad(${probe_bss} 10 probe_bss)
+    string(APPEND report "${name}${flash}${ram}${probe_bss}\n")
+endforeach()
+
+file(WRITE ${SIZE_DIR}/stardust_size.txt "${report}")
+message("${report}")
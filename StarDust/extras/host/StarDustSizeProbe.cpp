@@ -0,0 +1,46 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Size Probe
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Compiled once per configuration by the size report of the host build. The only object
+in it is a StarDust instance, so the .bss of this file is the RAM one link costs.
+STARDUST_SIZE_PROBE_PAYLOAD and STARDUST_SIZE_PROBE_CRYPTO pick a StarDustT instance
+instead of the default one. Not part of the Arduino library.
+
+*/
+
+#include "StarDust.h"
+
+#ifndef STARDUST_SIZE_PROBE_PAYLOAD
+    #define STARDUST_SIZE_PROBE_PAYLOAD PAYLOADSIZE
+#endif
+#ifndef STARDUST_SIZE_PROBE_CRYPTO
+    #define STARDUST_SIZE_PROBE_CRYPTO (STARDUST_CIPHER_MODE != STARDUST_CIPHER_NONE)
+#endif
+
+StarDustT<STARDUST_SIZE_PROBE_PAYLOAD, STARDUST_SIZE_PROBE_CRYPTO> stardustSizeProbe;
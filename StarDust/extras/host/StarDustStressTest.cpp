@@ -0,0 +1,169 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Multi-Producer Stress Test
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Several std::thread producers send on one StarDust instance (half through sendPayload(),
+half through send<T>()) while a writer thread calls update(). The port records every byte
+and counts writes that overlap in time. Afterwards the recording is decoded: every frame
+must pass the CRC, each producer's frames must arrive complete and in order, and no write
+may have overlapped another. Exits with 1 on any failure. Needs STARDUST_TX_QUEUE_DEPTH > 0
+and STARDUST_STATS; configure with -DSTARDUST_SANITIZE_THREAD=ON to run it under ThreadSanitizer.
+
+  stardust_stress_test [producers] [frames per producer]
+
+*/
+
+#include "StarDustHost.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#if STARDUST_TX_QUEUE_DEPTH == 0 || !STARDUST_STATS
+    #error "The stress test needs STARDUST_TX_QUEUE_DEPTH > 0 and STARDUST_STATS"
+#endif
+
+// Yazılan byte'ları kaydeden port. Kendi kilidi yoktur: eşzamanlı yazma hem sayaçta hem
+// ThreadSanitizer'da görünür. Yazma ortada bir kez bırakılır ki çakışma gerçekten oluşabilsin.
+// Port that records written bytes. It has no lock of its own: concurrent writes show up in
+// the counter and in ThreadSanitizer. A write yields once halfway so that an overlap can really happen.
+class RecordingStream : public Stream {
+public:
+    explicit RecordingStream(size_t capacity) : _bytes(capacity), _length(0), _writers(0), _overlaps(0) {}
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (_writers.fetch_add(1) != 0) _overlaps++;
+        if (size > _bytes.size() - _length) size = _bytes.size() - _length;
+        const size_t half = size / 2;
+        memcpy(&_bytes[_length], buffer, half);
+        std::this_thread::yield();
+        memcpy(&_bytes[_length + half], buffer + half, size - half);
+        _length += size;
+        _writers.fetch_sub(1);
+        return size;
+    }
+    int availableForWrite() override { return 64; }
+
+    const uint8_t* data() const { return _bytes.data(); }
+    size_t length() const { return _length; }
+    uint32_t overlaps() const { return _overlaps.load(); }
+
+private:
+    std::vector<uint8_t> _bytes;
+    size_t _length;
+    std::atomic<int> _writers;
+    std::atomic<uint32_t> _overlaps;
+};
+
+// Her örnek üreticiyi ve sırasını taşır; diğer alanlar bunlardan türetilir, bozulma payload'da da görünür
+// Every sample carries its producer and sequence; the other fields derive from them, so corruption shows in the payload too
+static TelemetryPayload stressTelemetry(uint8_t producer, uint32_t seq) {
+    TelemetryPayload tel = {producer, 41.0 + seq * 1e-6, 29.0 - producer, 100.0 + seq, (float)producer, -(float)producer, seq,
+                            (uint8_t)(seq ^ producer)};
+    return tel;
+}
+
+static bool sameTelemetry(const TelemetryPayload& a, const TelemetryPayload& b) {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+int main(int argc, char** argv) {
+    const uint32_t producers = (argc > 1) ? (uint32_t)atoi(argv[1]) : 6;
+    const uint32_t frames = (argc > 2) ? (uint32_t)atoi(argv[2]) : 5000;
+    if (producers == 0 || producers > 200 || frames == 0) {
+        fprintf(stderr, "usage: %s [producers 1..200] [frames per producer]\n", argv[0]);
+        return 2;
+    }
+
+    RecordingStream port((size_t)producers * frames * MAX_FRAME_SIZE);
+    StarDust sender;
+    sender.begin(port, 0x02, 0x01);
+
+    // Üreticiler şerit dolunca bırakıp yeniden dener; hiçbir çerçeve kaybolmamalıdır
+    // Producers yield and retry when the lane is full; no frame may get lost
+    std::atomic<uint32_t> running(producers);
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; p++) {
+        threads.emplace_back([&sender, &running, p, frames]() {
+            for (uint32_t seq = 0; seq < frames; seq++) {
+                const TelemetryPayload tel = stressTelemetry((uint8_t)p, seq);
+                while (!((p & 1) ? sender.send(tel) : sender.sendPayload(TELEMETRY, &tel, sizeof(tel)))) {
+                    std::this_thread::yield();
+                }
+            }
+            running.fetch_sub(1);
+        });
+    }
+    std::thread writer([&sender, &running]() {
+        while (running.load() > 0 || sender.txQueued() > 0) {
+            sender.update();
+        }
+    });
+    for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+    writer.join();
+
+    // Kaydı ayrıştır // Decode the recording
+    LoopbackStream line;
+    line.write(port.data(), port.length());
+    StarDust receiver;
+    receiver.begin(line, 0x01, 0x02);
+    receiver.setByteBudget(256);
+    std::vector<uint32_t> expected(producers, 0);
+    uint32_t received = 0, outOfOrder = 0, damaged = 0;
+    PacketData packet;
+    while (line.available() > 0 || receiver.peek() != nullptr) {
+        receiver.update();
+        while (receiver.pop(packet)) {
+            TelemetryPayload tel;
+            memcpy(&tel, packet.payload, sizeof(tel));
+            if (packet.header.type != TELEMETRY || packet.header.size != sizeof(tel) || tel.version >= producers) {
+                damaged++;
+                continue;
+            }
+            if (tel.timestamp != expected[tel.version]) outOfOrder++;
+            if (!sameTelemetry(tel, stressTelemetry(tel.version, tel.timestamp))) damaged++;
+            expected[tel.version] = tel.timestamp + 1;
+            received++;
+        }
+    }
+    uint32_t missing = 0;
+    for (uint32_t p = 0; p < producers; p++) missing += frames - expected[p];
+
+    const StarDustStats& stats = receiver.stats();
+    const uint32_t crcErrors = stats.framesCrcError + stats.framesMalformed;
+    printf("%u producers x %u frames: %u received, %u out of order, %u damaged, %u missing, %u overlapping writes, "
+           "%u CRC errors, %llu bytes\n",
+           producers, frames, received, outOfOrder, damaged, missing, port.overlaps(), crcErrors,
+           (unsigned long long)port.length());
+    const bool ok = received == producers * frames && outOfOrder == 0 && damaged == 0 && missing == 0 && port.overlaps() == 0 &&
+                    crcErrors == 0;
+    printf("%s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
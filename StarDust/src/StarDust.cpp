@@ -42,6 +42,25 @@ and a non-blocking parser for real-time applications.
 
 
 #include "StarDust.h"
+#if STARDUST_ROUTING
+    #include "StarDustRouter.h"
+#endif
+#include <math.h>
+
+// İstatistik sayaçları: STARDUST_STATS kapalıyken hiçbir kod üretmez
+// Statistics counters: generate no code while STARDUST_STATS is disabled
+#if STARDUST_STATS
+    #define STARDUST_STAT(statement) do { statement; } while (0)
+#else
+    #define STARDUST_STAT(statement) do {} while (0)
+#endif
+
+// Yakalama: kanca bağlı değilse ham çerçeve kurulmaz // Capture: no raw frame is built while no hook is attached
+#if STARDUST_CAPTURE
+    #define STARDUST_CAPTURE_FRAME(result) do { if (_capture != nullptr) captureFrame(result); } while (0)
+#else
+    #define STARDUST_CAPTURE_FRAME(result) do {} while (0)
+#endif
 
 // Başlangıç için varsayılan bir şifreleme anahtarı
 // Default encryption key for initial use
@@ -50,74 +69,228 @@ const uint8_t DEFAULT_KEY[16] = {
     0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16
 };
 
-StarDust::StarDust() {
+StarDustCore::StarDustCore(uint8_t* storage, uint8_t maxPayload, StarDustCipher::Schedule* key) {
     _port = nullptr;
     _myID = 0x01;
     _targetID = 0x00;
     _state = ParserState::WAIT_START;
     _bytesRead = 0;
+    _rxPayloadLength = 0;
+    _rxCrc = StarDustCRC::INIT;
+    _skipRemaining = 0;
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+    _cobsRun = 0;
+    _cobsZero = false;
+    _cobsSync = false;
+#endif
+    _addressFilter = AddressFilter::VALIDATE;
+    memset(_addressMask, 0, sizeof(_addressMask));
+    acceptAddress(_myID);
+    acceptAddress(BROADCAST_ID);
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    _txActiveLane = TX_IDLE;
+    _txOffset = 0;
+    _txBurst = 0;
+    _txHighWater = 0;
+    _txWriting = 0;
+    _txDropped = 0;
+#endif
     _lastRxTime = 0;
     _timeoutMs = 100; // Varsayılan timeout 100 milisaniye // Default timeout 100 milliseconds
-    memcpy(_cryptoKey, DEFAULT_KEY, 16);
-    memset(_rxBuffer, 0, sizeof(_rxBuffer));
+    _peerTimeout = nullptr;
+    _peerTimeoutContext = nullptr;
+    _maxPayload = maxPayload;
+    _cipher = key;
+    if (_cipher != nullptr) StarDustCipher::expand(*_cipher, DEFAULT_KEY);
+    _rxKey = _cipher;
+#if STARDUST_PEER_KEYS > 0
+    memset(_peerSlot, 0, sizeof(_peerSlot));
+    memset(_peerOwner, 0, sizeof(_peerOwner));
+#endif
+    _byteBudget = 0;
+    _rxHead = 0;
+    _rxCount = 0;
+    _rxExtra = 0;
+    _rxRest = 0;
+    _rxDropped = 0;
+    _rxSlots = storage;
+    _rxSlotSize = sizeof(PacketHeader) + maxPayload + sizeof(uint16_t);
+    memset(_rxSlots, 0, (STARDUST_RX_QUEUE_DEPTH + 1) * _rxSlotSize);
+    _rxBuffer = _rxSlots;
+    memset(_handlers, 0, sizeof(_handlers));
+#if STARDUST_STATS
+    resetStats();
+    _rxStartTime = 0;
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+    _statsInterval = 0;
+    _statsLastReport = 0;
+#endif
+#endif
+#if STARDUST_AGGREGATION
+    _batch = _rxSlots + (STARDUST_RX_QUEUE_DEPTH + 1) * _rxSlotSize; // Yuvalardan sonra // After the slots
+    _batchLength = 0;
+    _batchCount = 0;
+    _batchTarget = 0;
+    _batchEnabled = false;
+    _batchDelay = 0;
+    _batchStart = 0;
+#endif
+#if STARDUST_TELEMETRY_PEERS > 0
+    memset(&_teleKey, 0, sizeof(_teleKey));
+    _teleKeyId = 0;
+    _teleSinceKey = 0;
+    _teleInterval = 0;
+    _teleTarget = 0;
+    _teleForceKey = false;
+    memset(_telePeers, 0, sizeof(_telePeers));
+    _teleVictim = 0;
+    _teleMissed = 0;
+#endif
+    _unhandled = nullptr;
+    _unhandledContext = nullptr;
+    _observer = nullptr;
+    _observerContext = nullptr;
+#if STARDUST_CAPTURE
+    _capture = nullptr;
+    _captureContext = nullptr;
+#endif
+#if STARDUST_ROUTING
+    _router = nullptr;
+    _routerPort = 0;
+    _transit = false;
+#endif
 }
 
-void StarDust::begin(Stream& port, uint8_t myID, uint8_t defaultTargetID) {
+void StarDustCore::begin(Stream& port, uint8_t myID, uint8_t defaultTargetID) {
     _port = &port;
+    acceptAddress(_myID, false);
     _myID = myID;
+    acceptAddress(_myID);
+    acceptAddress(BROADCAST_ID);
     _targetID = defaultTargetID;
 }
 
-void StarDust::setCryptoKey(const uint8_t* newKey) {
-    if (newKey != nullptr) {
-        memcpy(_cryptoKey, newKey, 16); // Dinamik anahtar değişimi // Dynamic key change
+void StarDustCore::setCryptoKey(const uint8_t* newKey) {
+    if (newKey != nullptr && _cipher != nullptr) {
+        StarDustCipher::expand(*_cipher, newKey); // Dinamik anahtar değişimi // Dynamic key change
     }
 }
 
-void StarDust::setTimeout(uint32_t timeoutMs) {
+#if STARDUST_PEER_KEYS > 0
+bool StarDustCore::setPeerKey(uint8_t peerID, const uint8_t* key) {
+    uint8_t slot = _peerSlot[peerID];
+    if (_cipher == nullptr) return false; // Şifresiz örnek // Unencrypted instance
+    if (key == nullptr) {
+        _peerSlot[peerID] = 0;
+        return true;
+    }
+    if (slot == 0) {
+        // Boş yuva yalnızca anahtar eklenirken aranır, alım/gönderim yolunda arama yok
+        // A free slot is searched only when a key is added, never on the receive/send path
+        for (uint8_t i = 0; i < STARDUST_PEER_KEYS && slot == 0; i++) {
+            if (_peerSlot[_peerOwner[i]] != i + 1) slot = i + 1;
+        }
+        if (slot == 0) return false; // Tablo dolu // Table full
+        _peerOwner[slot - 1] = peerID;
+    }
+    StarDustCipher::expand(_peerKeys[slot - 1], key);
+    _peerSlot[peerID] = slot;
+    return true;
+}
+#endif
+
+const StarDustCipher::Schedule* StarDustCore::keyFor(uint8_t peerID) const {
+#if STARDUST_PEER_KEYS > 0
+    const uint8_t slot = _peerSlot[peerID];
+    if (slot != 0) return &_peerKeys[slot - 1];
+#else
+    (void)peerID;
+#endif
+    return _cipher;
+}
+
+void StarDustCore::setTimeout(uint32_t timeoutMs) {
     _timeoutMs = timeoutMs;
 }
 
-void StarDust::setTargetID(uint8_t targetID) {
+void StarDustCore::setPeerTimeout(PeerTimeout timeout, void* context) {
+    _peerTimeout = timeout;
+    _peerTimeoutContext = context;
+}
+
+uint32_t StarDustCore::frameTimeout() const {
+    // Başlık okunduysa kaynak bilinir; SKIP_FRAME'de de başlık tamponda durur
+    // Once the header is read the source is known; in SKIP_FRAME the header also stays in the buffer
+    if (_peerTimeout != nullptr && _state != ParserState::READ_HEADER && _bytesRead >= sizeof(PacketHeader)) {
+        const uint32_t timeout = _peerTimeout(((const PacketHeader*)_rxBuffer)->source, _peerTimeoutContext);
+        if (timeout > 0) return timeout;
+    }
+    return _timeoutMs;
+}
+
+void StarDustCore::setTargetID(uint8_t targetID) {
     _targetID = targetID;
 }
 
+uint8_t StarDustCore::getID() const {
+    return _myID;
+}
+
+void StarDustCore::setAddressFilter(AddressFilter mode) {
+    _addressFilter = mode;
+}
+
+void StarDustCore::acceptAddress(uint8_t id, bool accept) {
+    if (accept) {
+        _addressMask[id >> 3] |= (1 << (id & 7));
+    } else {
+        _addressMask[id >> 3] &= ~(1 << (id & 7));
+    }
+}
+
+bool StarDustCore::isAccepted(uint8_t target) const {
+    if (_addressFilter == AddressFilter::PROMISCUOUS) return true;
+    return (_addressMask[target >> 3] >> (target & 7)) & 1;
+}
+
+void StarDustCore::setByteBudget(uint16_t maxBytes) {
+    _byteBudget = maxBytes;
+}
+
 // ======================== GÜVENLİK VE CRC ========================
 // ======================== SECURITY AND CRC =======================
 
-uint16_t StarDust::calculateCRC16CCITT(const uint8_t* data, uint16_t length) {
-    uint16_t crc = 0xFFFF; //
-    for (uint16_t i = 0; i < length; ++i) {
-        crc ^= static_cast<uint16_t>(data[i]) << 8;
-        for (int j = 0; j < 8; ++j) {
-            if (crc & 0x8000) {
-                crc = (crc << 1) ^ 0x1021; //
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    return crc;
+uint16_t StarDustCore::calculateCRC16CCITT(const uint8_t* data, uint16_t length) {
+    // Tablo tabanlı motor, STARDUST_CRC_MODE ile seçilir (bkz. StarDustCRC.h)
+    // Table driven engine, selected with STARDUST_CRC_MODE (see StarDustCRC.h)
+    return StarDustCRC::compute(data, length); //
 }
 
-void StarDust::encryptPayload(uint8_t* payload, uint8_t size) {
-    for (uint8_t i = 0; i < size; i++) {
-        payload[i] ^= _cryptoKey[i % 16]; //
-        payload[i] = ((payload[i] << 3) | (payload[i] >> 5)) & 0xFF; //
-    }
+void StarDustCore::encryptPayload(uint8_t* payload, uint8_t size, const StarDustCipher::Schedule* key) {
+    // XOR + 3 bit döndürme, kelime/vektör genişliğinde (bkz. StarDustCipher.h); anahtarsız örnek düz metin gönderir
+    // XOR + 3-bit rotation, word/vector wide (see StarDustCipher.h); an instance without a key sends plain text
+    if (key != nullptr) StarDustCipher::encrypt(*key, payload, size); //
 }
 
-void StarDust::decryptPayload(uint8_t* payload, uint8_t size) {
-    for (uint8_t i = 0; i < size; i++) {
-        payload[i] = ((payload[i] >> 3) | (payload[i] << 5)) & 0xFF; //
-        payload[i] ^= _cryptoKey[i % 16]; //
-    }
+void StarDustCore::decryptPayload(uint8_t* payload, uint8_t size, uint8_t offset, const StarDustCipher::Schedule* key) {
+    // offset: payload içindeki konum, anahtar indeksi buna göre seçilir
+    // offset: position inside the payload, the key index is chosen from it
+    if (key != nullptr) StarDustCipher::decrypt(*key, payload, size, offset); //
 }
 
 
 // ======================== PAKET İŞLEME VE PARSER ========================
 // ===================== PACKET PROCESSING AND PARSER =====================
-void StarDust::preparePacket(PacketData& packet, PacketType type, const uint8_t* payloadData, uint8_t payloadSize) {
+uint8_t StarDustCore::wirePayloadSize(uint8_t payloadSize) {
+#if STARDUST_VARIABLE_FRAMES
+    return payloadSize; // Yalnızca gerçek payload gönderilir // Only the real payload is sent
+#else
+    (void)payloadSize;
+    return PAYLOADSIZE; // Sabit çerçeve // Fixed frame
+#endif
+}
+
+void StarDustCore::preparePacket(PacketData& packet, PacketType type, const uint8_t* payloadData, uint8_t payloadSize) {
     packet.header.start = PACKET_START_BYTE; //
     packet.header.source = _myID;
     packet.header.target = _targetID;
@@ -127,178 +300,1269 @@ void StarDust::preparePacket(PacketData& packet, PacketType type, const uint8_t*
     memset(packet.payload, 0, PAYLOADSIZE);
     memcpy(packet.payload, payloadData, payloadSize);
 
-    // CRC hesaplama Düz metin (plaintext) üzerinden yapılır
-    // CRC is calculated on the plaintext (before encryption)
-    packet.crc = calculateCRC16CCITT((uint8_t*)&packet, sizeof(PacketHeader) + PAYLOADSIZE);
+    // CRC hesaplama Düz metin (plaintext) üzerinden, yalnızca hatta giden byte'lar için yapılır
+    // CRC is calculated on the plaintext (before encryption), only over the bytes sent on the wire
+    const uint8_t wireSize = wirePayloadSize(payloadSize);
+    packet.crc = calculateCRC16CCITT((uint8_t*)&packet, sizeof(PacketHeader) + wireSize);
 
     // Ardından payload şifrelenir
     // Then the payload is encrypted
-    encryptPayload(packet.payload, PAYLOADSIZE);
+    encryptPayload(packet.payload, wireSize, keyFor(packet.header.target));
+}
+
+uint8_t StarDustCore::serializePacket(const PacketData& packet, uint8_t* out) {
+    // COBS'ta önde ayraç ve ilk kod byte'ına yer kalır // With COBS room is left in front for the delimiter and the first code byte
+    uint8_t* frame = out + STARDUST_FRAMING_OVERHEAD;
+    const uint8_t length = sizeof(PacketHeader) + wirePayloadSize(packet.header.size);
+    memcpy(frame, &packet, length);
+    memcpy(frame + length, &packet.crc, sizeof(packet.crc));
+    return finishFrame(out, length + sizeof(packet.crc));
+}
+
+uint8_t StarDustCore::buildFrame(uint8_t* out, uint8_t target, PacketType type, const uint8_t* payloadData, uint8_t payloadSize) {
+    // Çerçeve hattaki haliyle yerinde kurulur: başlık, düz payload, CRC, ardından payload şifrelenir
+    // The frame is built in place as it appears on the wire: header, plain payload, CRC, then the payload is encrypted
+    uint8_t* frame = out + STARDUST_FRAMING_OVERHEAD;
+    PacketHeader* header = (PacketHeader*)frame;
+    header->start = PACKET_START_BYTE;
+    header->source = _myID;
+    header->target = target;
+    header->type = type;
+    header->size = payloadSize;
+
+    const uint8_t wireSize = wirePayloadSize(payloadSize);
+    uint8_t* payload = frame + sizeof(PacketHeader);
+    memcpy(payload, payloadData, payloadSize);
+    memset(payload + payloadSize, 0, wireSize - payloadSize);
+
+    const uint16_t crc = calculateCRC16CCITT(frame, sizeof(PacketHeader) + wireSize);
+    memcpy(payload + wireSize, &crc, sizeof(crc));
+    encryptPayload(payload, wireSize, keyFor(header->target));
+    return finishFrame(out, sizeof(PacketHeader) + wireSize + sizeof(crc));
+}
+
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+// Yerinde COBS: çerçeve out[2..] aralığında durur. Her sıfır byte, sonraki sıfıra (veya sona) olan uzaklıkla
+// değiştirilir, ilk uzaklık out[1]'e yazılır. Ayraç çerçevenin önüne gelir: aradaki gürültü sıradaki çerçeveyi
+// bozamaz, çerçeve sonu başlıktaki boyuttan bilinir. Çerçeve 254 byte'tan kısa olduğu için 0xFF bloğu oluşmaz.
+// In-place COBS: the frame sits in out[2..]. Every zero byte is replaced by the distance to the next zero (or to
+// the end), the first distance goes into out[1]. The delimiter leads the frame: noise in between cannot spoil the
+// next frame, the end of a frame is known from the size in its header. Frames are shorter than 254 bytes, so no
+// 0xFF block occurs.
+uint8_t StarDustCore::finishFrame(uint8_t* out, uint8_t length) {
+    static_assert(sizeof(PacketData) < 254, "COBS framing assumes frames shorter than 254 bytes");
+    const uint8_t end = length + STARDUST_FRAMING_OVERHEAD;
+    uint8_t code = 1;
+    for (uint8_t i = STARDUST_FRAMING_OVERHEAD; i < end; i++) {
+        if (out[i] == 0) {
+            out[code] = i - code;
+            code = i;
+        }
+    }
+    out[code] = end - code;
+    out[0] = STARDUST_COBS_DELIMITER;
+    return end;
+}
+#endif
+
+bool StarDustCore::sendPayload(PacketType type, const void* payload, uint8_t size) {
+    return sendPayload(_targetID, type, payload, size);
+}
+
+bool StarDustCore::sendPayload(uint8_t target, PacketType type, const void* payload, uint8_t size) {
+    if (size > _maxPayload) return false;
+#if STARDUST_TELEMETRY_PEERS > 0
+    if (type == TELEMETRY && size == sizeof(TelemetryPayload) && _teleInterval > 0) {
+        uint8_t compact[PAYLOADSIZE];
+        const uint8_t compactSize = encodeTelemetry(target, *(const TelemetryPayload*)payload, compact);
+        return sendPayload(target, TELEMETRYCOMPACT, compact, compactSize);
+    }
+#endif
+#if STARDUST_AGGREGATION
+    if (batchPayload(target, type, (const uint8_t*)payload, size)) return true;
+    flushBatch(); // Sıra korunur: önce bekleyenler // Order is kept: the pending ones first
+#endif
+    return sendFrame(target, type, (const uint8_t*)payload, size);
+}
+
+bool StarDustCore::sendFrame(uint8_t target, PacketType type, const uint8_t* payload, uint8_t size) {
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    TxFrame* slot = reserveTx(type);
+    if (slot == nullptr) return false;
+    slot->length = buildFrame(slot->bytes, target, type, payload, size);
+    publishTx(type, slot);
+    return true;
+#else
+    if (_port == nullptr) return false;
+    uint8_t frame[MAX_FRAME_SIZE];
+    const uint8_t length = buildFrame(frame, target, type, payload, size);
+    const size_t written = _port->write(frame, length);
+    STARDUST_STAT(_stats.bytesOut += written);
+    return written == length;
+#endif
+}
+
+void StarDustCore::emitPacket(const PacketData& packet, const void* payload) {
+#if STARDUST_AGGREGATION
+    // sendX kopyası şifreli döner; toplamaya düz payload girer // The sendX copy is returned encrypted; the batch takes the plain payload
+    if (batchPayload(packet.header.target, packet.header.type, (const uint8_t*)payload, packet.header.size)) return;
+    flushBatch();
+#else
+    (void)payload;
+#endif
+    writePacket(packet);
+}
+
+#if STARDUST_AGGREGATION
+// ======================== ÇERÇEVE BİRLEŞTİRME ========================
+// ======================== FRAME AGGREGATION ==========================
+void StarDustCore::setAggregation(bool enabled, uint16_t delayMs) {
+    if (!enabled) flushBatch();
+    _batchEnabled = enabled;
+    _batchDelay = delayMs;
 }
 
-bool StarDust::validatePacket(PacketData* packet) {
-    if (packet->header.start != PACKET_START_BYTE) return false;
+bool StarDustCore::batchPayload(uint8_t target, PacketType type, const uint8_t* payload, uint8_t size) {
+    // Kayıt başına 2 byte: [tip, boyut] // 2 bytes per record: [type, size]
+    if (!_batchEnabled || type == EMERGENCY || type == AGGREGATE || size + 2 > _maxPayload) return false;
 
-    // Şifreyi çöz
-    // Decrypt the payload
-    decryptPayload(packet->payload, PAYLOADSIZE);
+    if (_batchLength > 0 && (_batchTarget != target || _batchLength + 2 + size > _maxPayload)) flushBatch();
+    if (_batchLength == 0) {
+        _batchTarget = target;
+        _batchStart = millis();
+    }
+    _batch[_batchLength] = type;
+    _batch[_batchLength + 1] = size;
+    memcpy(&_batch[_batchLength + 2], payload, size);
+    _batchLength += 2 + size;
+    _batchCount++;
+
+    if (_batchLength + 2 >= _maxPayload) flushBatch(); // Başka kayıt sığmaz // No other record fits
+    // Sıkıştırılmış telemetri son kayıt olur: alıcı onu yuvada tam boyutuna açarken arkasında kayıt kalmaz
+    // Compact telemetry becomes the last record: no record is left behind it when the receiver expands it in the slot
+    else if (type == TELEMETRYCOMPACT) flushBatch();
+    return true;
+}
 
-    // Çözülmüş halinin CRC'sini hesapla
-    // Calculate CRC of the decrypted payload
-    uint16_t calcCRC = calculateCRC16CCITT((uint8_t*)packet, sizeof(PacketHeader) + PAYLOADSIZE);
+bool StarDustCore::flushBatch() {
+    if (_batchLength == 0) return true;
+    // Tek kayıt kendi tipiyle gider, ek maliyet olmaz // A single record goes out as its own type, at no extra cost
+    const bool sent = (_batchCount == 1) ? sendFrame(_batchTarget, (PacketType)_batch[0], &_batch[2], _batch[1])
+                                         : sendFrame(_batchTarget, AGGREGATE, _batch, _batchLength);
+    _batchLength = 0;
+    _batchCount = 0;
+    return sent;
+}
+#endif
+
+#if STARDUST_TELEMETRY_PEERS > 0
+// ======================== SIKIŞTIRILMIŞ TELEMETRİ ========================
+// ======================== COMPACT TELEMETRY ==============================
+// Anahtar kare: [0x80 | kimlik][TelemetryPayload]
+// Fark:         [kimlik][alan maskesi][değişen alanlar...], sayılar zigzag + varint, anahtar kareye göre
+// İstek:        [0xFF], alıcıdan göndericiye: sıradaki örnek anahtar kare olur
+// Keyframe: [0x80 | id][TelemetryPayload]
+// Delta:    [id][field mask][changed fields...], numbers zigzag + varint, relative to the keyframe
+// Request:  [0xFF], from the receiver to the sender: the next sample becomes a keyframe
+namespace {
+const uint8_t TELEMETRY_KEYFRAME = 0x80;
+const uint8_t TELEMETRY_KEY_REQUEST = 0xFF;
+const uint8_t TELEMETRY_NO_KEY = 0xFF;
+// Maske bitleri TelemetryPayload alan sırasıyla // Mask bits in TelemetryPayload field order
+enum : uint8_t {
+    FIELD_VERSION = 0x01, FIELD_LATITUDE = 0x02, FIELD_LONGITUDE = 0x04, FIELD_ALTITUDE = 0x08,
+    FIELD_YAW = 0x10, FIELD_PITCH = 0x20, FIELD_TIMESTAMP = 0x40, FIELD_STATUS = 0x80
+};
 
-    // CRC eşleşiyorsa ve paket bize veya genel yayına (broadcast) gelmişse geçerlidir
-    // If CRC matches and the packet is addressed to us or is a broadcast, it's valid
-    if (calcCRC == packet->crc) {
-        if (packet->header.target == _myID || packet->header.target == BROADCAST_ID) {
+uint8_t putVarint(uint8_t* out, int32_t value) {
+    uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    uint8_t length = 0;
+    while (zigzag >= 0x80) {
+        out[length++] = (uint8_t)zigzag | 0x80;
+        zigzag >>= 7;
+    }
+    out[length++] = (uint8_t)zigzag;
+    return length;
+}
+
+bool getVarint(const uint8_t* data, uint8_t size, uint8_t& pos, int32_t& value) {
+    uint32_t zigzag = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        if (pos >= size) return false;
+        const uint8_t byte = data[pos++];
+        zigzag |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
             return true;
         }
     }
     return false;
 }
 
-bool StarDust::parseByte(uint8_t incomingByte, PacketData& outPacket) {
+// Anahtar kareye göre ölçeklenmiş fark; int32'ye sığmazsa (veya NaN ise) false
+// Scaled difference from the keyframe; false when it does not fit into int32 (or is NaN)
+bool scaledDelta(double value, double key, double scale, int32_t& delta) {
+    const double steps = (value - key) * scale;
+    if (!(fabs(steps) < 2.0e9)) return false;
+    delta = (int32_t)lround(steps);
+    return true;
+}
+
+bool putScaled(uint8_t* out, uint8_t& pos, uint8_t& mask, uint8_t bit, double value, double key, double scale) {
+    int32_t delta;
+    if (!scaledDelta(value, key, scale, delta)) return false;
+    if (delta != 0) {
+        mask |= bit;
+        pos += putVarint(&out[pos], delta);
+    }
+    return true;
+}
+}
+
+void StarDustCore::setTelemetryCompression(bool enabled, uint8_t keyframeInterval) {
+    _teleInterval = enabled ? (keyframeInterval > 0 ? keyframeInterval : 1) : 0;
+    _teleForceKey = true; // Yeni akış anahtar kareyle başlar // A new stream starts with a keyframe
+}
+
+uint32_t StarDustCore::telemetryMissed() const {
+    return _teleMissed;
+}
+
+uint8_t StarDustCore::encodeTelemetry(uint8_t target, const TelemetryPayload& sample, uint8_t* out) {
+    if (!_teleForceKey && _teleSinceKey + 1 < _teleInterval && target == _teleTarget) {
+        uint8_t mask = 0;
+        uint8_t pos = 2;
+        if (sample.version != _teleKey.version) { mask |= FIELD_VERSION; out[pos++] = sample.version; }
+        bool fits = putScaled(out, pos, mask, FIELD_LATITUDE, sample.latitude, _teleKey.latitude, STARDUST_TELEMETRY_POSITION_SCALE)
+                 && putScaled(out, pos, mask, FIELD_LONGITUDE, sample.longitude, _teleKey.longitude, STARDUST_TELEMETRY_POSITION_SCALE)
+                 && putScaled(out, pos, mask, FIELD_ALTITUDE, sample.altitude, _teleKey.altitude, STARDUST_TELEMETRY_ALTITUDE_SCALE)
+                 && putScaled(out, pos, mask, FIELD_YAW, sample.yaw, _teleKey.yaw, STARDUST_TELEMETRY_ANGLE_SCALE)
+                 && putScaled(out, pos, mask, FIELD_PITCH, sample.pitch, _teleKey.pitch, STARDUST_TELEMETRY_ANGLE_SCALE);
+        if (fits) {
+            if (sample.timestamp != _teleKey.timestamp) {
+                mask |= FIELD_TIMESTAMP;
+                pos += putVarint(&out[pos], (int32_t)(sample.timestamp - _teleKey.timestamp));
+            }
+            if (sample.status != _teleKey.status) { mask |= FIELD_STATUS; out[pos++] = sample.status; }
+            out[0] = _teleKeyId;
+            out[1] = mask;
+            _teleSinceKey++;
+            return pos;
+        }
+    }
+
+    // Anahtar kare: tam örnek, sonraki farkların referansı // Keyframe: the full sample, reference for the next deltas
+    _teleKeyId = (_teleKeyId + 1) % 127; // 0x80 | 127 istek byte'ı olurdu // 0x80 | 127 would be the request byte
+    memcpy(&_teleKey, &sample, sizeof(TelemetryPayload));
+    _teleSinceKey = 0;
+    _teleTarget = target;
+    _teleForceKey = false;
+    out[0] = TELEMETRY_KEYFRAME | _teleKeyId;
+    memcpy(&out[1], &sample, sizeof(TelemetryPayload));
+    return 1 + sizeof(TelemetryPayload);
+}
+
+StarDustCore::TelemetryPeer* StarDustCore::telemetryPeer(uint8_t source, bool create) {
+    for (uint8_t i = 0; i < STARDUST_TELEMETRY_PEERS; i++) {
+        if (_telePeers[i].used && _telePeers[i].source == source) return &_telePeers[i];
+    }
+    if (!create) return nullptr;
+    // Tablo doluysa sırayla en eski yuva devralınır // When the table is full slots are taken over in turn
+    TelemetryPeer* peer = nullptr;
+    for (uint8_t i = 0; i < STARDUST_TELEMETRY_PEERS && peer == nullptr; i++) {
+        if (!_telePeers[i].used) peer = &_telePeers[i];
+    }
+    if (peer == nullptr) {
+        peer = &_telePeers[_teleVictim];
+        _teleVictim = (_teleVictim + 1) % STARDUST_TELEMETRY_PEERS;
+    }
+    peer->used = true;
+    peer->source = source;
+    peer->keyId = TELEMETRY_NO_KEY;
+    peer->requested = TELEMETRY_NO_KEY;
+    return peer;
+}
+
+// Yuva yerinde TELEMETRY paketine çevrilir; false: kayıt kullanıcıya verilmez
+// The slot is turned into a TELEMETRY packet in place; false: the record is not handed to the user
+bool StarDustCore::decodeTelemetry(PacketData& packet) {
+    const uint8_t size = packet.header.size;
+    if (size == 0) return false;
+    const uint8_t id = packet.payload[0];
+
+    if (id == TELEMETRY_KEY_REQUEST) {
+        if (packet.header.target == _myID) _teleForceKey = true;
+        return false;
+    }
+
+    if (id & TELEMETRY_KEYFRAME) {
+        if (size != 1 + sizeof(TelemetryPayload)) return false;
+        TelemetryPeer* peer = telemetryPeer(packet.header.source, true);
+        peer->keyId = id & 0x7F;
+        memcpy(&peer->key, &packet.payload[1], sizeof(TelemetryPayload));
+        memmove(packet.payload, &packet.payload[1], sizeof(TelemetryPayload));
+        packet.header.type = TELEMETRY;
+        packet.header.size = sizeof(TelemetryPayload);
+        return true;
+    }
+
+    TelemetryPeer* peer = telemetryPeer(packet.header.source, true);
+    if (peer->keyId != id) {
+        // Anahtar kare kayıp: her eksik anahtar kare için bir kez yenisi istenir
+        // Keyframe lost: a new one is asked for once per missing keyframe
+        _teleMissed++;
+        if (peer->requested != id) {
+            peer->requested = id;
+            const uint8_t request = TELEMETRY_KEY_REQUEST;
+            sendPayload(packet.header.source, TELEMETRYCOMPACT, &request, 1);
+        }
+        return false;
+    }
+    // Açılan örnek, yuvanın sonunda bekleyen toplama kayıtlarına taşmamalı
+    // The expanded sample must not run into aggregate records waiting at the end of the slot
+    if (size < 2 || _rxRest + sizeof(TelemetryPayload) > _maxPayload) return false;
+
+    const uint8_t mask = packet.payload[1];
+    TelemetryPayload sample;
+    memcpy(&sample, &peer->key, sizeof(TelemetryPayload));
+    uint8_t pos = 2;
+    int32_t delta = 0;
+    if (mask & FIELD_VERSION) { if (pos >= size) return false; sample.version = packet.payload[pos++]; }
+    if (mask & FIELD_LATITUDE) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.latitude += delta / (double)STARDUST_TELEMETRY_POSITION_SCALE; }
+    if (mask & FIELD_LONGITUDE) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.longitude += delta / (double)STARDUST_TELEMETRY_POSITION_SCALE; }
+    if (mask & FIELD_ALTITUDE) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.altitude += delta / (double)STARDUST_TELEMETRY_ALTITUDE_SCALE; }
+    if (mask & FIELD_YAW) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.yaw += (float)(delta / (double)STARDUST_TELEMETRY_ANGLE_SCALE); }
+    if (mask & FIELD_PITCH) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.pitch += (float)(delta / (double)STARDUST_TELEMETRY_ANGLE_SCALE); }
+    if (mask & FIELD_TIMESTAMP) { if (!getVarint(packet.payload, size, pos, delta)) return false; sample.timestamp += (uint32_t)delta; }
+    if (mask & FIELD_STATUS) { if (pos >= size) return false; sample.status = packet.payload[pos++]; }
+    if (pos != size) return false;
+
+    memcpy(packet.payload, &sample, sizeof(TelemetryPayload));
+    packet.header.type = TELEMETRY;
+    packet.header.size = sizeof(TelemetryPayload);
+    return true;
+}
+#endif
+
+void StarDustCore::writePacket(const PacketData& packet) {
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    // Kuyruğa al ve portun şu an kabul ettiği kadarını yaz; çağıran hiçbir zaman bloklanmaz
+    // Queue it and write as much as the port accepts right now; the caller never blocks
+    TxFrame* slot = reserveTx(packet.header.type);
+    if (slot == nullptr) return;
+    slot->length = serializePacket(packet, slot->bytes);
+    publishTx(packet.header.type, slot);
+#else
+    if (_port == nullptr) return;
+
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+    uint8_t frame[MAX_FRAME_SIZE];
+    const size_t written = _port->write(frame, serializePacket(packet, frame));
+#else
+    // Değişken uzunlukta CRC, payload'ın hemen ardından gelir
+    // With variable-length frames the CRC directly follows the payload
+    size_t written = _port->write((const uint8_t*)&packet, sizeof(PacketHeader) + wirePayloadSize(packet.header.size));
+    written += _port->write((const uint8_t*)&packet.crc, sizeof(packet.crc));
+#endif
+    STARDUST_STAT(_stats.bytesOut += written);
+    (void)written;
+#endif
+}
+
+#if STARDUST_TX_QUEUE_DEPTH > 0
+uint8_t StarDustCore::txLane(PacketType type) {
+    switch (type) {
+        case EMERGENCY:
+        case ERROR:
+        case SYSTEMCOMMAND:
+        case RELIABLEACK: // Onaylar veri kuyruğunu beklemez, gidiş-dönüş süresi kısalır // Acks do not wait behind data, the round trip gets shorter
+            return TX_LANE_PRIORITY;
+        default:
+            return TX_LANE_NORMAL;
+    }
+}
+
+StarDustCore::TxFrame* StarDustCore::reserveTx(PacketType type) {
+    TxFrame* slot = _txLanes[txLane(type)].reserve();
+    if (slot == nullptr) stardustAtomicIncrement(&_txDropped);
+    return slot;
+}
+
+void StarDustCore::publishTx(PacketType type, TxFrame* slot) {
+    _txLanes[txLane(type)].publish(slot);
+
+    stardustAtomicMax(&_txHighWater, txQueued());
+    flushTx();
+}
+
+uint8_t StarDustCore::flushTx() {
+    if (_port == nullptr) return txQueued();
+
+    // Aynı anda yalnızca bir görev yazar; kilit alınamazsa beklenmez, çerçeveler sıradaki çağrıda gider
+    // Only one task writes at a time; if the flag is taken we do not wait, frames go out on the next call
+    uint8_t idle = 0;
+    if (!stardustCompareExchange(&_txWriting, idle, (uint8_t)1)) return txQueued();
+    const uint8_t queued = drainTx();
+    __atomic_store_n(&_txWriting, (uint8_t)0, __ATOMIC_RELEASE);
+    return queued;
+}
+
+uint8_t StarDustCore::drainTx() {
+    // Port boş alan bildirmiyorsa (ör. SoftwareSerial) _txBurst kadar byte yazılır
+    // If the port does not report free space (e.g. SoftwareSerial) _txBurst bytes are written
+    int space = _port->availableForWrite();
+    if (space <= 0) space = _txBurst;
+
+    while (space > 0) {
+        if (_txActiveLane == TX_IDLE) {
+            // Yeni çerçeve: önce öncelikli şerit
+            // New frame: priority lane first
+            for (uint8_t i = 0; i < TX_LANES; i++) {
+                if (_txLanes[i].front() != nullptr) {
+                    _txActiveLane = i;
+                    _txOffset = 0;
+                    break;
+                }
+            }
+            if (_txActiveLane == TX_IDLE) break;
+        }
+
+        TxFrame* frame = _txLanes[_txActiveLane].front();
+        size_t chunk = frame->length - _txOffset;
+        if (chunk > (size_t)space) chunk = space;
+        const size_t written = _port->write(frame->bytes + _txOffset, chunk);
+        STARDUST_STAT(_stats.bytesOut += written);
+        _txOffset += written;
+        space -= written;
+
+        if (_txOffset == frame->length) {
+            _txLanes[_txActiveLane].release();
+            _txActiveLane = TX_IDLE;
+        } else if (written < chunk) {
+            break; // Port beklenenden az kabul etti // The port accepted less than expected
+        }
+    }
+    return txQueued();
+}
+
+void StarDustCore::setTxBurst(uint8_t maxBytes) {
+    _txBurst = maxBytes;
+}
+
+uint8_t StarDustCore::txQueued() const {
+    return _txLanes[TX_LANE_PRIORITY].size() + _txLanes[TX_LANE_NORMAL].size();
+}
+
+uint8_t StarDustCore::txHighWater() const {
+    return stardustAtomicLoad(&_txHighWater);
+}
+
+uint32_t StarDustCore::txDropped() const {
+    return stardustAtomicLoad(&_txDropped);
+}
+#endif
+
+bool StarDustCore::validatePacket(const PacketData* packet) {
+    // CRC parser tarafından byte byte doğrulandı, burada yalnızca adres kontrol edilir
+    // The CRC was verified byte by byte by the parser, only the address is checked here
+
+    // Paket bize, genel yayına (broadcast) veya kabul edilen bir grup adresine gelmişse geçerlidir
+    // The packet is valid if it is addressed to us, to broadcast or to an accepted group address
+    return isAccepted(packet->header.target);
+}
+
+StarDustCore::ParseResult StarDustCore::parseByte(uint8_t incomingByte) {
     switch (_state) {
         case ParserState::WAIT_START:
             if(incomingByte == PACKET_START_BYTE) {
                 _rxBuffer[0] = incomingByte;
                 _bytesRead = 1;
+                _rxCrc = StarDustCRC::update(StarDustCRC::INIT, incomingByte);
                 _state = ParserState::READ_HEADER;
+                STARDUST_STAT(_rxStartTime = STARDUST_STATS_CLOCK());
             }
             break;
             
         case ParserState::READ_HEADER:
             _rxBuffer[_bytesRead++] = incomingByte;
+            _rxCrc = StarDustCRC::update(_rxCrc, incomingByte);
             if(_bytesRead == sizeof(PacketHeader)) {
-                _state = ParserState::READ_PAYLOAD;
+                const PacketHeader* header = (const PacketHeader*)_rxBuffer;
+
+                // Geçersiz boyut: başlık bozuk, senkronizasyonu yeniden ara
+                // Invalid size: header is corrupt, look for sync again
+                if (header->size > _maxPayload) {
+                    _state = ParserState::WAIT_START;
+                    return ParseResult::FAILED;
+                }
+
+                _rxPayloadLength = wirePayloadSize(header->size);
+                _rxKey = keyFor(header->source);
+#if STARDUST_ROUTING
+                // Yönlendiricinin başka porttan yolu olan yabancı hedef: çerçeve hattaki haliyle toplanır
+                // Foreign target the router has a route to on another port: the frame is collected in its wire form
+                _transit = _router != nullptr && !isAccepted(header->target) && _router->routes(_routerPort, header->target);
+#endif
+
+                // Erken süzgeç: bize gelmeyen çerçevenin geri kalanı kopyalanmadan, çözülmeden ve CRC'siz atlanır
+                // Early filter: the rest of a frame not meant for us is skipped without copy, decryption or CRC
+                // Derlenmemiş paket tipi de aynı yoldan atlanır; yönlendiriciye bağlı port onu başka porta taşıyabilir
+                // A packet type that is not compiled in is skipped the same way; a port bound to a router may carry it to another port
+                if ((_addressFilter == AddressFilter::EARLY && !isAccepted(header->target) && !isTransit())
+                    || (STARDUST_HANDLER_SLOT(header->type) == STARDUST_TYPE_DISABLED && !isRouted())) {
+                    STARDUST_STAT(_stats.framesForeign++);
+                    _skipRemaining = _rxPayloadLength + sizeof(uint16_t);
+                    _state = ParserState::SKIP_FRAME;
+                    break;
+                }
+
+                // Hatta gelmeyecek payload kısmı sıfırlanır
+                // The part of the payload that will not arrive is zeroed
+                memset(_rxBuffer + sizeof(PacketHeader) + _rxPayloadLength, 0, _maxPayload - _rxPayloadLength);
+                _state = (_rxPayloadLength > 0) ? ParserState::READ_PAYLOAD : ParserState::READ_CRC;
             }
             break;
             
         case ParserState::READ_PAYLOAD:
-            _rxBuffer[_bytesRead++] = incomingByte;
-            if(_bytesRead == sizeof(PacketHeader) + PAYLOADSIZE) {
-                _state = ParserState::READ_CRC;
-            }
+            readPayload(&incomingByte, 1);
             break;
             
-        case ParserState::READ_CRC:
-            _rxBuffer[_bytesRead++] = incomingByte;
-            if(_bytesRead == sizeof(PacketData)) {
+        case ParserState::READ_CRC: {
+            // CRC byte'ları, kısa payload'da bile PacketData::crc alanına yazılır
+            // CRC bytes are stored in the PacketData::crc field even for short payloads
+            const uint16_t crcIndex = _bytesRead - sizeof(PacketHeader) - _rxPayloadLength;
+            slotCrc(_rxBuffer)[crcIndex] = incomingByte;
+            _bytesRead++;
+            if(crcIndex + 1 == sizeof(uint16_t)) {
                 _state = ParserState::WAIT_START;
                 
                 PacketData* potentialPacket = (PacketData*)_rxBuffer;
-                
-                if (validatePacket(potentialPacket)) {
-                    // Güvenli kopyalama: Sadece geçerli paket outPacket'e yazılır
-                    // Safe copying: Only valid packets are copied to outPacket
-                    memcpy(&outPacket, potentialPacket, sizeof(PacketData));
-                    return true;
+                uint16_t receivedCrc;
+                memcpy(&receivedCrc, slotCrc(_rxBuffer), sizeof(receivedCrc));
+
+                // CRC hatası: başlangıç byte'ı sahte olabilir, tampon yeniden taranmalı. COBS'ta çerçeve sınırı
+                // ayraçtan bilindiği için geçiş çerçevesinin CRC'sine yalnızca hedefi bakar.
+                // CRC failure: the start byte may have been spurious, the buffer must be rescanned. With COBS the
+                // frame boundary is known from the delimiter, so only the target checks the CRC of a transit frame.
+                if (_rxCrc != receivedCrc && !(STARDUST_FRAMING == STARDUST_FRAMING_COBS && isTransit())) {
+                    return ParseResult::FAILED;
+                }
+
+                const bool accepted = validatePacket(potentialPacket);
+                STARDUST_CAPTURE_FRAME(accepted ? CaptureResult::VALID : CaptureResult::FOREIGN);
+#if STARDUST_ROUTING
+                // Geçiş çerçeveleri ve (yayma açıksa) genel yayınlar yönlendiriciye verilir
+                // Transit frames and (with flooding on) broadcasts are handed to the router
+                if (_transit || (accepted && _router != nullptr && potentialPacket->header.target == BROADCAST_ID &&
+                                 _router->routes(_routerPort, BROADCAST_ID))) {
+                    forwardFrame();
                 }
+#endif
+                if (accepted) {
+#if STARDUST_STATS
+                    recordFrame(potentialPacket->header.type);
+#endif
+                    // Toplama çerçevesi tek yuvada kalır, kayıtları sırası gelince yerinde açılır
+                    // An aggregate frame stays in one slot, its records are unpacked in place when its turn comes
+                    const uint8_t records = (potentialPacket->header.type == AGGREGATE) ? countRecords(*potentialPacket) : 1;
+                    if (records == 0) {
+                        STARDUST_STAT(_stats.framesMalformed++);
+                        break;
+                    }
+                    // Paket zaten kuyruk yuvasında kuruldu, kopyalamadan yayınlanır
+                    // The packet was built in its queue slot already, it is published without a copy
+                    if (commitPacket()) {
+                        _rxExtra += records - 1;
+                        if (_rxCount == 1) {
+                            expandHead();
+                            settleHead();
+                        }
+                    }
+                    return ParseResult::PACKET;
+                }
+                STARDUST_STAT(_stats.framesForeign++);
             }
             break;
+        }
+
+        case ParserState::SKIP_FRAME:
+            skipBytes(1);
+            break;
     }
-    return false;
+    return ParseResult::NONE;
+}
+
+size_t StarDustCore::readPayload(const uint8_t* data, size_t length) {
+    const uint8_t offset = _bytesRead - sizeof(PacketHeader);
+    const size_t remaining = _rxPayloadLength - offset;
+    if (length > remaining) length = remaining;
+
+    // Byte'lar geldiği anda çözülür ve CRC'ye eklenir, son byte'tan sonra tampon taranmaz
+    // Bytes are decrypted and added to the CRC on arrival, no buffer pass after the last byte
+    uint8_t* dst = &_rxBuffer[_bytesRead];
+    memcpy(dst, data, length);
+    if (isTransit()) {
+#if STARDUST_FRAMING != STARDUST_FRAMING_COBS
+        // Geçiş çerçevesi şifreli kalır; CRC, sahte bir başlangıç byte'ı yeniden taranabilsin diye yine doğrulanır
+        // A transit frame stays encrypted; the CRC is still checked so that a spurious start byte can be rescanned
+        if (_rxKey != nullptr) {
+            uint8_t plain[PAYLOADSIZE];
+            memcpy(plain, data, length);
+            StarDustCipher::decrypt(*_rxKey, plain, length, offset);
+            _rxCrc = StarDustCRC::update(_rxCrc, plain, length);
+        } else {
+            _rxCrc = StarDustCRC::update(_rxCrc, data, length);
+        }
+#endif
+    } else {
+        decryptPayload(dst, length, offset, _rxKey);
+        _rxCrc = StarDustCRC::update(_rxCrc, dst, length);
+    }
+    _bytesRead += length;
+
+    if(_bytesRead == sizeof(PacketHeader) + _rxPayloadLength) {
+        _state = ParserState::READ_CRC;
+    }
+    return length;
+}
+
+size_t StarDustCore::skipBytes(size_t length) {
+    if (length > _skipRemaining) length = _skipRemaining;
+    _skipRemaining -= length;
+    if (_skipRemaining == 0) {
+        _state = ParserState::WAIT_START;
+    }
+    return length;
+}
+
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+// ======================== COBS ÇÖZÜCÜ ========================
+// ======================== COBS DECODER =======================
+// Kod byte'ları burada çözülür; veri byte'ları aynı çerçeve durum makinesine gider, payload yine parça halinde
+// çözülür. Reddedilen çerçeve yeniden taranmaz: alıcı sıradaki ayraca kadar memchr ile atlar.
+// Code bytes are decoded here; data bytes go to the same frame state machine, the payload is still decrypted
+// in chunks. A rejected frame is not rescanned: the receiver skips to the next delimiter with memchr.
+void StarDustCore::beginCobsFrame() {
+    _cobsSync = true;
+    _cobsRun = 0;
+    _cobsZero = false;
+    _state = ParserState::WAIT_START;
+    _bytesRead = 0;
+}
+
+void StarDustCore::cobsByte(uint8_t decoded) {
+    if (parseByte(decoded) == ParseResult::FAILED) {
+        STARDUST_STAT(_bytesRead == sizeof(PacketHeader) ? _stats.framesMalformed++ : _stats.framesCrcError++);
+        STARDUST_CAPTURE_FRAME(_bytesRead == sizeof(PacketHeader) ? CaptureResult::MALFORMED : CaptureResult::CRC_ERROR);
+    }
+    // Çerçeve bitti (kabul, ret veya erken süzgeç): sonrası bir sonraki ayraca kadar atlanır
+    // The frame is over (accepted, rejected or early filter): what follows is skipped up to the next delimiter
+    if (_state == ParserState::WAIT_START || _state == ParserState::SKIP_FRAME) {
+        _state = ParserState::WAIT_START;
+        _cobsSync = false;
+    }
+}
+
+void StarDustCore::parseBytes(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        if (!_cobsSync) {
+            const uint8_t* delimiter = (const uint8_t*)memchr(data, STARDUST_COBS_DELIMITER, length);
+            if (delimiter == nullptr) return;
+            length -= delimiter - data + 1;
+            data = delimiter + 1;
+            beginCobsFrame();
+            continue;
+        }
+        if (*data == STARDUST_COBS_DELIMITER) {
+            // Çerçeve ortasında ayraç: byte kaybolmuş, yeni çerçeve hemen başlar
+            // Delimiter in the middle of a frame: bytes were lost, the new frame starts right away
+            if (_state != ParserState::WAIT_START || _cobsRun > 0) STARDUST_STAT(_stats.framesMalformed++);
+            if (_state != ParserState::WAIT_START) STARDUST_CAPTURE_FRAME(CaptureResult::MALFORMED);
+            beginCobsFrame();
+            data++;
+            length--;
+            continue;
+        }
+        if (_cobsRun == 0) {
+            // Kod byte'ı: önceki blok bir sıfırla bittiyse o sıfır şimdi verilir
+            // Code byte: if the previous block ended with a zero, that zero is handed over now
+            const uint8_t code = *data++;
+            length--;
+            const bool zero = _cobsZero;
+            _cobsRun = code - 1;
+            _cobsZero = (code != 0xFF);
+            if (zero) cobsByte(0);
+            continue;
+        }
+        // Blok verisi; bozuk hatta bloğun içindeki bir ayraç da çerçeveyi bitirir
+        // Block data; on a corrupted line a delimiter inside the block ends the frame as well
+        size_t run = (length < _cobsRun) ? length : _cobsRun;
+        const uint8_t* delimiter = (const uint8_t*)memchr(data, STARDUST_COBS_DELIMITER, run);
+        if (delimiter != nullptr) run = delimiter - data;
+        size_t used = 0;
+        if (_state == ParserState::READ_PAYLOAD) {
+            used = readPayload(data, run);
+        } else {
+            // Başlık ve CRC byte'ları: payload başlayana veya çerçeve bitene kadar aynı döngüde
+            // Header and CRC bytes: in the same loop until the payload starts or the frame ends
+            while (used < run && _cobsSync && _state != ParserState::READ_PAYLOAD) cobsByte(data[used++]);
+        }
+        data += used;
+        length -= used;
+        _cobsRun -= used;
+    }
+}
+#else
+void StarDustCore::parseBytes(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        if (_state == ParserState::WAIT_START) {
+            // Başlangıç byte'ına kadar olan gürültü tek seferde atlanır
+            // Noise up to the start byte is skipped in one go
+            const uint8_t* start = (const uint8_t*)memchr(data, PACKET_START_BYTE, length);
+            if (start == nullptr) return;
+            length -= start - data;
+            data = start;
+        } else if (_state == ParserState::READ_PAYLOAD) {
+            // Payload bölümü byte byte değil, parça halinde işlenir
+            // The payload section is processed as a chunk, not byte by byte
+            const size_t used = readPayload(data, length);
+            data += used;
+            length -= used;
+            continue;
+        } else if (_state == ParserState::SKIP_FRAME) {
+            const size_t used = skipBytes(length);
+            data += used;
+            length -= used;
+            continue;
+        }
+        if (parseByte(*data++) == ParseResult::FAILED) {
+            // Yeniden tarama sırasındaki sahte adaylar sayılmaz, yalnızca hattan gelen ret
+            // Spurious candidates during the rescan are not counted, only the rejection from the line
+            STARDUST_STAT(_bytesRead == sizeof(PacketHeader) ? _stats.framesMalformed++ : _stats.framesCrcError++);
+            STARDUST_CAPTURE_FRAME(_bytesRead == sizeof(PacketHeader) ? CaptureResult::MALFORMED : CaptureResult::CRC_ERROR);
+            resync();
+        }
+        length--;
+    }
+}
+
+void StarDustCore::resync() {
+    // Reddedilen çerçevenin byte'ları atılmaz: ilk byte'tan sonraki her başlangıç adayı yeniden denenir.
+    // Böylece sahte bir 0xAA'nın içinde başlayan gerçek çerçeve kaybolmaz.
+    // The bytes of the rejected frame are not thrown away: every start candidate after the first byte
+    // is tried again, so a real frame that began inside a spurious 0xAA frame is not lost.
+    uint8_t work[sizeof(PacketData)];
+    const uint8_t length = rawFrame(work);
+    STARDUST_STAT(_stats.resyncs++);
+
+    _state = ParserState::WAIT_START;
+    _bytesRead = 0;
+
+    // Özyineleme yok: yeniden taramada başarısız olan çerçevenin byte'ları zaten work içinde
+    // No recursion: the bytes of a frame failing during the rescan are already inside work
+    uint8_t pos = 1;
+    uint8_t frameStart = 0;
+    while (pos < length) {
+        if (_state == ParserState::WAIT_START) {
+            const uint8_t* start = (const uint8_t*)memchr(work + pos, PACKET_START_BYTE, length - pos);
+            if (start == nullptr) break;
+            pos = start - work;
+            frameStart = pos;
+        } else if (_state == ParserState::READ_PAYLOAD) {
+            pos += readPayload(work + pos, length - pos);
+            continue;
+        } else if (_state == ParserState::SKIP_FRAME) {
+            pos += skipBytes(length - pos);
+            continue;
+        }
+        if (parseByte(work[pos++]) == ParseResult::FAILED) {
+            pos = frameStart + 1;
+        }
+    }
+}
+#endif
+
+uint8_t StarDustCore::rawFrame(uint8_t* out) {
+    // Başlık ve CRC byte'ları ham tutulur, çözülmüş payload yeniden şifrelenerek hattaki hali elde edilir
+    // Header and CRC bytes are kept raw, the decrypted payload is encrypted again to get the wire bytes
+    uint8_t length = (_bytesRead < sizeof(PacketHeader)) ? _bytesRead : sizeof(PacketHeader);
+    memcpy(out, _rxBuffer, length);
+
+    if (_bytesRead > sizeof(PacketHeader)) {
+        uint8_t payloadRead = _bytesRead - sizeof(PacketHeader);
+        if (payloadRead > _rxPayloadLength) payloadRead = _rxPayloadLength;
+        memcpy(out + length, _rxBuffer + sizeof(PacketHeader), payloadRead);
+        if (!isTransit()) encryptPayload(out + length, payloadRead, _rxKey); // Geçiş çerçevesi zaten şifreli // A transit frame is encrypted already
+        length += payloadRead;
+
+        const uint8_t crcRead = _bytesRead - sizeof(PacketHeader) - payloadRead;
+        memcpy(out + length, slotCrc(_rxBuffer), crcRead);
+        length += crcRead;
+    }
+    return length;
+}
+
+#if STARDUST_ROUTING
+void StarDustCore::forwardFrame() {
+    uint8_t frame[sizeof(PacketData)];
+    const uint8_t length = rawFrame(frame);
+    _router->transit(_routerPort, frame, length);
+}
+
+bool StarDustCore::sendRaw(const uint8_t* frame, uint8_t length) {
+    // Çerçeve başka bir porttan geldiği gibi gider, yalnızca bu portun çerçevelemesi eklenir
+    // The frame goes out as it came in on another port, only the framing of this port is added
+    const PacketType type = ((const PacketHeader*)frame)->type;
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    TxFrame* slot = reserveTx(type);
+    if (slot == nullptr) return false;
+    memcpy(slot->bytes + STARDUST_FRAMING_OVERHEAD, frame, length);
+    slot->length = finishFrame(slot->bytes, length);
+    publishTx(type, slot);
+    return true;
+#else
+    (void)type;
+    if (_port == nullptr) return false;
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+    uint8_t out[MAX_FRAME_SIZE];
+    memcpy(out + STARDUST_FRAMING_OVERHEAD, frame, length);
+    const size_t written = _port->write(out, finishFrame(out, length));
+#else
+    const size_t written = _port->write(frame, length);
+#endif
+    STARDUST_STAT(_stats.bytesOut += written);
+    (void)written;
+    return true;
+#endif
+}
+#endif
+
+#if STARDUST_CAPTURE
+void StarDustCore::captureFrame(CaptureResult result) {
+    // Çerçeve hattaki haline geri getirilir; COBS'ta yeniden kodlanır
+    // The frame is brought back to its wire form; with COBS it is encoded again
+    uint8_t frame[MAX_FRAME_SIZE];
+    const uint8_t length = finishFrame(frame, rawFrame(frame + STARDUST_FRAMING_OVERHEAD));
+    _capture(frame, length, result, _captureContext);
+}
+#endif
+
+bool StarDustCore::commitPacket() {
+    if (_rxCount == STARDUST_RX_QUEUE_DEPTH) {
+        // Kuyruk dolu: yeni paket atılır, çalışma yuvası yeniden kullanılır
+        // Queue full: the new packet is dropped and the working slot is reused
+        _rxDropped++;
+        STARDUST_STAT(_stats.framesDropped++);
+        return false;
+    }
+    _rxCount++;
+    _rxBuffer = (uint8_t*)&rxSlot((_rxHead + _rxCount) % (STARDUST_RX_QUEUE_DEPTH + 1));
+    return true;
 }
 
-bool StarDust::update(PacketData& outPacket) {
-    if (_port == nullptr) return false; //
+// ======================== TOPLAMA ÇERÇEVESİ AÇMA ========================
+// ======================== AGGREGATE UNPACKING ===========================
+// Kayıtlar: [tip, boyut, veri]... Bozuk bir kayıttan sonrası atılır, geçerli kayıt sayısı döner
+// Records: [type, size, data]... Everything after a malformed record is dropped, returns the number of valid records
+uint8_t StarDustCore::countRecords(PacketData& packet) {
+    uint8_t pos = 0;
+    uint8_t records = 0;
+    while (pos + 2 <= packet.header.size) {
+        const uint8_t type = packet.payload[pos];
+        const uint8_t size = packet.payload[pos + 1];
+        if (type == AGGREGATE || size > packet.header.size - pos - 2) break;
+#if STARDUST_STATS
+        const uint8_t slot = STARDUST_HANDLER_SLOT(type);
+        if (slot < STARDUST_HANDLER_COUNT) _stats.packetsByType[slot]++;
+#endif
+        pos += 2 + size;
+        records++;
+    }
+    packet.header.size = pos;
+    return records;
+}
+
+// Baştaki toplama yuvası ilk kaydına dönüştürülür: kayıt payload'ın başına, kalanlar sonuna taşınır.
+// İkisi hiçbir zaman çakışmaz (kayıt + 2 + kalan <= maxPayload), kopya veya ek yuva gerekmez.
+// The aggregate slot at the head is turned into its first record: the record moves to the start of the payload,
+// the rest to its end. The two never overlap (record + 2 + rest <= maxPayload), no copy or extra slot is needed.
+void StarDustCore::expandHead() {
+    PacketData& packet = rxSlot(_rxHead);
+    if (packet.header.type != AGGREGATE) return;
+    const uint8_t size = packet.payload[1];
+    const uint8_t rest = packet.header.size - 2 - size;
+    memmove(&packet.payload[_maxPayload - rest], &packet.payload[2 + size], rest);
+    _rxRest = rest;
+    packet.header.type = (PacketType)packet.payload[0];
+    packet.header.size = size;
+    memmove(packet.payload, &packet.payload[2], size);
+    memset(slotCrc((uint8_t*)&packet), 0, sizeof(uint16_t)); // Bütünlük toplama çerçevesinde doğrulandı // Integrity was verified on the aggregate frame
+}
+
+void StarDustCore::advanceHead() {
+    stepHead();
+    settleHead();
+}
+
+// Baştaki kayıt kullanıcıya gösterilmeden önce çözülür; çözülemeyen veya yalnızca iç kullanım için olan kayıt atlanır
+// The head record is decoded before the user sees it; a record that cannot be decoded or is internal only is skipped
+void StarDustCore::settleHead() {
+#if STARDUST_TELEMETRY_PEERS > 0
+    while (_rxCount > 0 && rxSlot(_rxHead).header.type == TELEMETRYCOMPACT && !decodeTelemetry(rxSlot(_rxHead))) {
+        stepHead();
+    }
+#endif
+}
+
+void StarDustCore::stepHead() {
+    PacketData& packet = rxSlot(_rxHead);
+    if (_rxRest > 0) {
+        // Aynı yuvadaki sıradaki kayıt // The next record in the same slot
+        const uint8_t* record = &packet.payload[_maxPayload - _rxRest];
+        const uint8_t size = record[1];
+        packet.header.type = (PacketType)record[0];
+        packet.header.size = size;
+        memmove(packet.payload, record + 2, size);
+        _rxRest -= 2 + size;
+        _rxExtra--;
+        return;
+    }
+    _rxHead = (_rxHead + 1) % (STARDUST_RX_QUEUE_DEPTH + 1);
+    _rxCount--;
+    if (_rxCount > 0) expandHead();
+}
+
+uint8_t StarDustCore::available() const {
+    const uint16_t queued = _rxCount + _rxExtra;
+    return (queued < 0xFF) ? queued : 0xFF;
+}
+
+const PacketData* StarDustCore::peek() const {
+    return (_rxCount > 0) ? &rxSlot(_rxHead) : nullptr;
+}
+
+// Yuva, tam boy PacketData'ya açılır: maxPayload sonrası sıfırlanır, CRC kendi alanına taşınır
+// A slot is widened to a full PacketData: the bytes past maxPayload are zeroed, the CRC moves to its own field
+void StarDustCore::copySlot(const PacketData& slot, PacketData& out) const {
+    memcpy(&out, &slot, sizeof(PacketHeader) + _maxPayload);
+    memset(out.payload + _maxPayload, 0, PAYLOADSIZE - _maxPayload);
+    memcpy(&out.crc, slotCrc((uint8_t*)&slot), sizeof(out.crc));
+}
+
+bool StarDustCore::pop(PacketData& outPacket) {
+    if (_rxCount == 0) return false;
+    copySlot(rxSlot(_rxHead), outPacket);
+    advanceHead();
+    return true;
+}
+
+uint32_t StarDustCore::droppedPackets() const {
+    return _rxDropped;
+}
 
-    // Zaman Aşımı Kontrolü
-    // Timeout Control
-    if (_state != ParserState::WAIT_START) {
-        if (millis() - _lastRxTime > _timeoutMs) {
+#if STARDUST_STATS
+void StarDustCore::recordFrame(PacketType type) {
+    _stats.framesGood++;
+    const uint8_t slot = STARDUST_HANDLER_SLOT(type);
+    if (slot < STARDUST_HANDLER_COUNT) _stats.packetsByType[slot]++;
+
+    const uint32_t latency = STARDUST_STATS_CLOCK() - _rxStartTime;
+    if (latency < _stats.latencyMin) _stats.latencyMin = latency;
+    if (latency > _stats.latencyMax) _stats.latencyMax = latency;
+    // Toplam taşmaya yaklaşınca ikisi de yarıya iner: ortalama yakın geçmişi izler
+    // Both are halved before the sum overflows: the average follows the recent past
+    if (_stats.latencySum > UINT32_MAX - latency || _stats.latencySamples == UINT32_MAX) {
+        _stats.latencySum /= 2;
+        _stats.latencySamples /= 2;
+    }
+    _stats.latencySum += latency;
+    _stats.latencySamples++;
+}
+
+const StarDustStats& StarDustCore::stats() const {
+    return _stats;
+}
+
+uint32_t StarDustCore::packetsOfType(PacketType type) const {
+    const uint8_t slot = STARDUST_HANDLER_SLOT(type);
+    return (slot < STARDUST_HANDLER_COUNT) ? _stats.packetsByType[slot] : 0;
+}
+
+void StarDustCore::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.latencyMin = UINT32_MAX;
+}
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+void StarDustCore::setStatsInterval(uint32_t intervalMs) {
+    _statsInterval = intervalMs;
+    _statsLastReport = millis();
+}
+
+bool StarDustCore::sendLinkStats() {
+    LinkStatsPayload payload;
+    payload.version = 1;
+    payload.infoType = STARDUST_INFO_LINK_STATS;
+    payload.framesGood = _stats.framesGood;
+    payload.framesCrcError = _stats.framesCrcError;
+    payload.framesMalformed = _stats.framesMalformed;
+    payload.framesTimedOut = _stats.framesTimedOut;
+    payload.framesForeign = _stats.framesForeign;
+    payload.framesDropped = _stats.framesDropped;
+    payload.bytesIn = _stats.bytesIn;
+    payload.bytesOut = _stats.bytesOut;
+    payload.resyncs = _stats.resyncs;
+    payload.latencyMin = (_stats.latencySamples > 0) ? _stats.latencyMin : 0;
+    payload.latencyAvg = _stats.latencyAvg();
+    payload.latencyMax = _stats.latencyMax;
+    return send(payload);
+}
+#endif
+#endif
+
+void StarDustCore::removeHandler(PacketType type) {
+    const uint8_t slot = STARDUST_HANDLER_SLOT(type);
+    if (slot < STARDUST_HANDLER_COUNT) {
+        _handlers[slot].invoke = nullptr;
+    }
+}
+
+void StarDustCore::onUnhandled(void (*handler)(const PacketData& packet, void* context), void* context) {
+    _unhandled = handler;
+    _unhandledContext = context;
+}
+
+#if STARDUST_CAPTURE
+void StarDustCore::onCapture(CaptureHook hook, void* context) {
+    _capture = hook;
+    _captureContext = context;
+}
+#endif
+
+void StarDustCore::onDispatch(void (*observer)(const PacketData& packet, void* context), void* context) {
+    _observer = observer;
+    _observerContext = context;
+}
+
+uint8_t StarDustCore::dispatch() {
+    update();
+
+    uint8_t handled = 0;
+    while (_rxCount > 0) {
+        // Paket kuyruk yuvasında kalır, işleyici döndükten sonra yuva serbest bırakılır
+        // The packet stays in its queue slot, the slot is released after the handler returns
+        // Kısa yuvalı örnekte payload önce tam boy PacketData'ya açılır, işleyici yuvanın dışını okumaz
+        // On an instance with short slots the payload is first widened to a full PacketData, so handlers never read past the slot
+        PacketData wide;
+        const PacketData* slotPacket = &rxSlot(_rxHead);
+        if (_maxPayload < PAYLOADSIZE) {
+            copySlot(*slotPacket, wide);
+            slotPacket = &wide;
+        }
+        const PacketData& packet = *slotPacket;
+        if (_observer != nullptr) _observer(packet, _observerContext);
+        const uint8_t slot = STARDUST_HANDLER_SLOT(packet.header.type);
+        if (slot < STARDUST_HANDLER_COUNT && _handlers[slot].invoke != nullptr) {
+            _handlers[slot].invoke(_handlers[slot].handler, packet, _handlers[slot].context);
+            handled++;
+        } else if (_unhandled != nullptr) {
+            _unhandled(packet, _unhandledContext);
+            handled++;
+        }
+        advanceHead();
+    }
+    return handled;
+}
+
+#if STARDUST_FEED_BUFFER_SIZE > 0
+size_t StarDustCore::feed(const uint8_t* data, size_t len) {
+    // Kesme bağlamında güvenli: yalnızca halka tampona kopyalar, millis() veya sanal çağrı yok
+    // Safe in interrupt context: only copies into the ring, no millis() and no virtual calls
+    return _feedRing.push(data, len);
+}
+#endif
+
+uint8_t StarDustCore::update() {
+#if STARDUST_FEED_BUFFER_SIZE > 0
+    const bool feedPending = !_feedRing.empty();
+#else
+    const bool feedPending = false;
+#endif
+    if (_port == nullptr && !feedPending) return available(); //
+
+#if STARDUST_AGGREGATION
+    // Süresi dolan toplama, kuyruk boşaltılmadan önce gönderilir // An expired batch is sent before the queue is drained
+    if (_batchLength > 0 && millis() - _batchStart >= _batchDelay) flushBatch();
+#endif
+
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    // Bekleyen gönderimler bloklamadan ilerletilir
+    // Pending transmissions are advanced without blocking
+    flushTx();
+#endif
+
+    // Zaman Aşımı Kontrolü (feed() ile bekleyen byte'lar hat etkinliği sayılır)
+    // Timeout Control (bytes pending from feed() count as line activity)
+    const uint32_t now = millis();
+    if (_state != ParserState::WAIT_START && !feedPending) {
+        if (now - _lastRxTime > frameTimeout()) {
+            STARDUST_CAPTURE_FRAME(CaptureResult::TIMEOUT);
             _state = ParserState::WAIT_START; // Zaman dolduysa state'i sıfırla   // Reset state if timeout occurs
+            STARDUST_STAT(_stats.framesTimedOut++);
             _bytesRead = 0;
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+            _cobsSync = false; // Yarım çerçevenin kalanı sıradaki ayraca kadar atlanır // The rest of the partial frame is skipped up to the next delimiter
+#endif
         }
     }
 
-    bool packetReceived = false;
-    while (_port->available() > 0) {
-        uint8_t b = _port->read();
-        _lastRxTime = millis();
-        // Parse incoming byte and check if a complete packet has been received
-        
-        if (parseByte(b, outPacket)) {
-            packetReceived = true;
+
+    // Byte bütçesi, tek bir çağrının gecikmesini sınırlar; kalan byte'lar bir sonraki çağrıya kalır
+    // The byte budget bounds the latency of a single call; remaining bytes wait for the next call
+    size_t budget = (_byteBudget > 0) ? _byteBudget : SIZE_MAX;
+    bool received = false;
+
+#if STARDUST_FEED_BUFFER_SIZE > 0
+    // Kesme/DMA ile gelen bloklar parça parça ayrıştırılır
+    // Bursts delivered by interrupt/DMA are parsed span by span
+    const uint8_t* span;
+    size_t spanLength;
+    while (budget > 0 && (spanLength = _feedRing.peekSpan(&span)) > 0) {
+        if (spanLength > budget) spanLength = budget;
+        parseBytes(span, spanLength);
+        STARDUST_STAT(_stats.bytesIn += spanLength);
+        _feedRing.consume(spanLength);
+        budget -= spanLength;
+        received = true;
+    }
+#endif
+
+    if (_port != nullptr) {
+        // Stream byte'ları küçük bir yığın tamponunda toplanıp blok halinde ayrıştırılır
+        // Stream bytes are gathered in a small stack buffer and parsed as a block
+        uint8_t chunk[32];
+        while (budget > 0 && _port->available() > 0) {
+            size_t count = 0;
+            while (count < sizeof(chunk) && count < budget && _port->available() > 0) {
+                chunk[count++] = _port->read();
+            }
+            parseBytes(chunk, count);
+            STARDUST_STAT(_stats.bytesIn += count);
+            budget -= count;
+            received = true;
         }
     }
-    return packetReceived;
+
+    // Zaman damgası byte başına değil, blok başına bir kez güncellenir
+    // The timestamp is updated once per burst instead of once per byte
+    if (received) _lastRxTime = millis();
+
+#if STARDUST_STATS && STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+    if (_statsInterval > 0 && now - _statsLastReport >= _statsInterval) {
+        _statsLastReport = now;
+        sendLinkStats();
+    }
+#endif
+    return available();
+}
+
+bool StarDustCore::update(PacketData& outPacket) {
+    update();
+    return pop(outPacket);
 }
 
 
 
 
-PacketData StarDust::sendAccept(uint8_t version, uint8_t acceptType, bool accepted) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
+PacketData StarDustCore::sendAccept(uint8_t version, uint8_t acceptType, bool accepted) {
     AcceptPayload payload = {version, acceptType, accepted};
     PacketData packet;
     preparePacket(packet, PacketType::ACCEPT, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendRefuse(uint8_t version, uint8_t refuseType, bool refused) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
+PacketData StarDustCore::sendRefuse(uint8_t version, uint8_t refuseType, bool refused) {
     RefusePayload payload = {version, refuseType, refused};
     PacketData packet;
     preparePacket(packet, PacketType::REFUSE, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendCommand(uint8_t version,double targetLat,double targetLon,float targetAlt,uint8_t actionCode) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+PacketData StarDustCore::sendCommand(uint8_t version,double targetLat,double targetLon,float targetAlt,uint8_t actionCode) {
     CommandPayload payload = {version, targetLat, targetLon, targetAlt, actionCode};
     PacketData packet;
     preparePacket(packet, PacketType::COMMAND, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendError(uint8_t version, uint16_t errorCode, uint16_t errorLocation, uint8_t errorSeverity) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+PacketData StarDustCore::sendError(uint8_t version, uint16_t errorCode, uint16_t errorLocation, uint8_t errorSeverity) {
     ErrorPayload payload = {version, errorCode, errorLocation, errorSeverity};
     PacketData packet;
     preparePacket(packet, PacketType::ERROR, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendEmergency(uint8_t version, uint16_t emergencyCode, uint16_t emergencyLocation, uint8_t emergencySeverity) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
+PacketData StarDustCore::sendEmergency(uint8_t version, uint16_t emergencyCode, uint16_t emergencyLocation, uint8_t emergencySeverity) {
     EmergencyPayload payload = {version, emergencyCode, emergencyLocation, emergencySeverity};
     PacketData packet;
     preparePacket(packet, PacketType::EMERGENCY, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendSystemCommand(uint8_t version, uint16_t commandCode, uint16_t commandParameter, uint8_t commandSenderID, uint8_t commandAuthorityLevel) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
+PacketData StarDustCore::sendSystemCommand(uint8_t version, uint16_t commandCode, uint16_t commandParameter, uint8_t commandSenderID, uint8_t commandAuthorityLevel) {
     SystemCommandPayload payload = {version, commandCode, commandParameter, commandSenderID, commandAuthorityLevel};
     PacketData packet;
     preparePacket(packet, PacketType::SYSTEMCOMMAND, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendSystemInfo(uint8_t version, uint8_t infoType, bool systemOperational, float systemLoad, float systemTemperature, float systemVoltage, uint32_t uptime, float systemErrorChance, float expectedErrorChance, float systemReliability) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+PacketData StarDustCore::sendSystemInfo(uint8_t version, uint8_t infoType, bool systemOperational, float systemLoad, float systemTemperature, float systemVoltage, uint32_t uptime, float systemErrorChance, float expectedErrorChance, float systemReliability) {
     SystemInfoPayload payload = {version, infoType, systemOperational, systemLoad, systemTemperature, systemVoltage, uptime, systemErrorChance, expectedErrorChance, systemReliability};
     PacketData packet;
     preparePacket(packet, PacketType::SYSTEMINFO, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendSystemHeartbeat(uint8_t version, bool beatStatus, float systemErrorChance, float expectedErrorChance, uint8_t missedBeats) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+PacketData StarDustCore::sendSystemHeartbeat(uint8_t version, bool beatStatus, float systemErrorChance, float expectedErrorChance, uint8_t missedBeats) {
     SystemHeartbeatPayload payload = {version, beatStatus, systemErrorChance, expectedErrorChance, missedBeats};
     PacketData packet;
     preparePacket(packet, PacketType::SYSTEMHEARTBEAT, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
-PacketData StarDust::sendBetrayal(uint8_t version, bool isBetrayal, uint16_t betrayalCode, uint16_t betrayalLocation, uint8_t betrayalSeverity, bool knowsSecret, bool planExecuted, bool hasEscapePlan, bool preparedForBetrayal, float betrayalSuccessChance, float betrayalDetectionChance, bool hasAllies, uint8_t numberOfAllies, float allyLoyalty, bool knighFall) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
+PacketData StarDustCore::sendBetrayal(uint8_t version, bool isBetrayal, uint16_t betrayalCode, uint16_t betrayalLocation, uint8_t betrayalSeverity, bool knowsSecret, bool planExecuted, bool hasEscapePlan, bool preparedForBetrayal, float betrayalSuccessChance, float betrayalDetectionChance, bool hasAllies, uint8_t numberOfAllies, float allyLoyalty, bool knighFall) {
     BetrayalPayload payload = {version, isBetrayal, betrayalCode, betrayalLocation, betrayalSeverity, knowsSecret, planExecuted, hasEscapePlan, preparedForBetrayal, betrayalSuccessChance, betrayalDetectionChance, hasAllies, numberOfAllies, allyLoyalty, knighFall};
     PacketData packet;
     preparePacket(packet, PacketType::BETRAYAL, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData));
+    emitPacket(packet, &payload);
     return packet;
 }
+#endif
 
 
 
@@ -306,84 +1570,119 @@ PacketData StarDust::sendBetrayal(uint8_t version, bool isBetrayal, uint16_t bet
 // ======================== GÖNDERİM VE ALIM SARMALAYICILARI ========================
 // ======================== TRANSMISSION AND RECEPTION WRAPPERS ======================
 
-PacketData StarDust::sendRequest(uint8_t version, uint8_t requestType, bool isCritical) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
+PacketData StarDustCore::sendRequest(uint8_t version, uint8_t requestType, bool isCritical) {
     RequestPayload payload = {version, requestType, isCritical}; //
     PacketData packet;
     preparePacket(packet, PacketType::REQUEST, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData)); //
+    emitPacket(packet, &payload); //
     return packet;
 }
+#endif
 
-PacketData StarDust::sendTelemetry(uint8_t version, double latitude, double longitude, double altitude, float yaw, float pitch, uint32_t timestamp, uint8_t status) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
+PacketData StarDustCore::sendTelemetry(uint8_t version, double latitude, double longitude, double altitude, float yaw, float pitch, uint32_t timestamp, uint8_t status) {
     TelemetryPayload payload = {version, latitude, longitude, altitude, yaw, pitch, timestamp, status}; //
     PacketData packet;
+#if STARDUST_TELEMETRY_PEERS > 0
+    if (_teleInterval > 0) {
+        uint8_t compact[PAYLOADSIZE];
+        const uint8_t compactSize = encodeTelemetry(_targetID, payload, compact);
+        preparePacket(packet, PacketType::TELEMETRYCOMPACT, compact, compactSize);
+        emitPacket(packet, compact);
+        return packet;
+    }
+#endif
     preparePacket(packet, PacketType::TELEMETRY, (uint8_t*)&payload, sizeof(payload));
-    if(_port != nullptr) _port->write((uint8_t*)&packet, sizeof(PacketData)); //
+    emitPacket(packet, &payload); //
     return packet;
 }
+#endif
 
-RequestPayload StarDust::receiveRequest(const PacketData& packet) { 
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
+RequestPayload StarDustCore::receiveRequest(const PacketData& packet) { 
     RequestPayload payload;
     memcpy(&payload, packet.payload, sizeof(RequestPayload)); //
     return payload; 
 }
+#endif
 
-TelemetryPayload StarDust::receiveTelemetry(const PacketData& packet) { 
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
+TelemetryPayload StarDustCore::receiveTelemetry(const PacketData& packet) { 
     TelemetryPayload payload;
     memcpy(&payload, packet.payload, sizeof(TelemetryPayload)); //
     return payload;
 }
+#endif
 
-AcceptPayload StarDust::receiveAccept(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
+AcceptPayload StarDustCore::receiveAccept(const PacketData& packet) {
     AcceptPayload payload;
     memcpy(&payload, packet.payload, sizeof(AcceptPayload));
     return payload;
 }
+#endif
 
-RefusePayload StarDust::receiveRefuse(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
+RefusePayload StarDustCore::receiveRefuse(const PacketData& packet) {
     RefusePayload payload;
     memcpy(&payload, packet.payload, sizeof(RefusePayload));
     return payload;
 }
+#endif
 
-CommandPayload StarDust::receiveCommand(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
+CommandPayload StarDustCore::receiveCommand(const PacketData& packet) {
     CommandPayload payload;
     memcpy(&payload, packet.payload, sizeof(CommandPayload));
     return payload;
 }
+#endif
 
-ErrorPayload StarDust::receiveError(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
+ErrorPayload StarDustCore::receiveError(const PacketData& packet) {
     ErrorPayload payload;
     memcpy(&payload, packet.payload, sizeof(ErrorPayload));
     return payload;
 }
+#endif
 
-EmergencyPayload StarDust::receiveEmergency(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
+EmergencyPayload StarDustCore::receiveEmergency(const PacketData& packet) {
     EmergencyPayload payload;
     memcpy(&payload, packet.payload, sizeof(EmergencyPayload));
     return payload;
 }
+#endif
 
-SystemCommandPayload StarDust::receiveSystemCommand(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
+SystemCommandPayload StarDustCore::receiveSystemCommand(const PacketData& packet) {
     SystemCommandPayload payload;
     memcpy(&payload, packet.payload, sizeof(SystemCommandPayload));
     return payload;
 }
+#endif
 
-SystemInfoPayload StarDust::receiveSystemInfo(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+SystemInfoPayload StarDustCore::receiveSystemInfo(const PacketData& packet) {
     SystemInfoPayload payload;
     memcpy(&payload, packet.payload, sizeof(SystemInfoPayload));
     return payload;
 }
+#endif
 
-SystemHeartbeatPayload StarDust::receiveSystemHeartbeat(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+SystemHeartbeatPayload StarDustCore::receiveSystemHeartbeat(const PacketData& packet) {
     SystemHeartbeatPayload payload;
     memcpy(&payload, packet.payload, sizeof(SystemHeartbeatPayload));
     return payload;
 }
+#endif
 
-BetrayalPayload StarDust::receiveBetrayal(const PacketData& packet) {
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
+BetrayalPayload StarDustCore::receiveBetrayal(const PacketData& packet) {
     BetrayalPayload payload;
     memcpy(&payload, packet.payload, sizeof(BetrayalPayload));
     return payload;
 }
+#endif
@@ -47,36 +47,200 @@ and a non-blocking parser for real-time applications.
 
 #include <stdint.h>
 #include <string.h>
+#include "StarDustCRC.h"
+#include "StarDustCipher.h"
+#include "StarDustRing.h"
 
 #ifdef ARDUINO
     #include <Arduino.h>
 #else
-    #include <cstddef>
+    #include <stddef.h> // avr-g++ C++ başlıkları olmadan da derler // Also builds with avr-g++, which has no C++ headers
     // PC testleri veya özel ortamlar için temel Stream sınıfı
     // Basic Stream class for PC testing or special environments
     class Stream {
     public:
         virtual size_t write(const uint8_t* buffer, size_t size) { return 0; }
+        virtual int availableForWrite() { return 0; }
         virtual int available() { return 0; }
         virtual int read() { return -1; }
     };
     extern uint32_t millis(); // RTOS veya PC için kendi millis fonksiyonunuzu sağlamalısınız bu sayede çakışma önlenir
                               // You should provide your own millis function for RTOS or PC; this will prevent conflicts.
+    extern uint32_t micros(); // Yalnızca STARDUST_STATS ve StarDustScheduler için gerekir // Only needed for STARDUST_STATS and StarDustScheduler
 #endif
 
 /* MUTLAK PROTOKOL TANIMLAYICILARI */
 /* ABSOLUTE PROTOCOL IDENTIFIERS */
 constexpr uint8_t PACKET_START_BYTE = 0xAA; //
-constexpr uint8_t PAYLOADSIZE = 64;         //
+// Azami payload boyutu. Sabit çerçevelerde (STARDUST_VARIABLE_FRAMES 0) iki uç aynı değeri kullanmalıdır;
+// küçük değer alım kuyruğunu, gönderim kuyruğunu ve toplama tamponunu birlikte küçültür
+// Maximum payload size. With fixed frames (STARDUST_VARIABLE_FRAMES 0) both ends must use the same value;
+// a smaller value shrinks the receive queue, the transmit queue and the batch buffer together
+#ifndef STARDUST_PAYLOAD_SIZE
+    #define STARDUST_PAYLOAD_SIZE 64
+#endif
+static_assert(STARDUST_PAYLOAD_SIZE >= 16 && STARDUST_PAYLOAD_SIZE <= 240, "STARDUST_PAYLOAD_SIZE must be 16..240");
+constexpr uint8_t PAYLOADSIZE = STARDUST_PAYLOAD_SIZE; //
 constexpr uint8_t BROADCAST_ID = 0xFF;
 
+/* DERLEME ZAMANI AYARLARI */
+/* COMPILE-TIME SETTINGS */
+// 1: Değişken uzunluklu çerçeve, hatta yalnızca header.size kadar payload byte'ı gönderilir
+// 0: v2.0.0 ile uyumlu sabit 71 byte'lık çerçeve (payload her zaman PAYLOADSIZE)
+// 1: Variable-length frames, only header.size payload bytes are put on the wire
+// 0: Fixed 71-byte frames compatible with v2.0.0 (payload is always PAYLOADSIZE)
+#ifndef STARDUST_VARIABLE_FRAMES
+    #define STARDUST_VARIABLE_FRAMES 1
+#endif
+
+// Çerçeveleme: 0xAA başlangıç byte'ı veya COBS (her çerçevenin önünde 0x00 ayraç). COBS'ta ayraç hatta başka
+// hiçbir yerde görünmez; bozuk bir çerçeveden sonra alıcı her zaman sıradaki ayraçta eşlenir (çerçeve başına 2 byte)
+// Framing: 0xAA start byte or COBS (a 0x00 delimiter in front of every frame). With COBS the delimiter appears
+// nowhere else on the line; after a broken frame the receiver always syncs at the next delimiter (2 bytes per frame)
+#define STARDUST_FRAMING_START_BYTE 0
+#define STARDUST_FRAMING_COBS       1
+#ifndef STARDUST_FRAMING
+    #define STARDUST_FRAMING STARDUST_FRAMING_START_BYTE
+#endif
+
+// Alım kuyruğu derinliği: update() çağrıları arasında saklanabilecek doğrulanmış paket sayısı
+// Receive queue depth: number of validated packets kept between update() calls
+#ifndef STARDUST_RX_QUEUE_DEPTH
+    #if defined(__AVR__)
+        #define STARDUST_RX_QUEUE_DEPTH 2
+    #else
+        #define STARDUST_RX_QUEUE_DEPTH 8
+    #endif
+#endif
+static_assert(STARDUST_RX_QUEUE_DEPTH >= 1 && STARDUST_RX_QUEUE_DEPTH < 255, "STARDUST_RX_QUEUE_DEPTH must be 1..254");
+
+// Gönderim kuyruğu derinliği (şerit başına, 2'nin kuvveti, 0 = sendX doğrudan ve bloklayarak yazar)
+// Transmit queue depth (per lane, power of two, 0 = sendX writes directly and blocking)
+#ifndef STARDUST_TX_QUEUE_DEPTH
+    #define STARDUST_TX_QUEUE_DEPTH 0
+#endif
+
+// feed() için kesme/DMA tamponu boyutu (2'nin kuvveti, 0 = feed() kapalı)
+// Interrupt/DMA buffer size for feed() (power of two, 0 = feed() disabled)
+#ifndef STARDUST_FEED_BUFFER_SIZE
+    #if defined(__AVR__)
+        #define STARDUST_FEED_BUFFER_SIZE 64
+    #else
+        #define STARDUST_FEED_BUFFER_SIZE 256
+    #endif
+#endif
+
+// Eş başına anahtar tablosu boyutu (0 = tüm eşler ortak anahtarı kullanır)
+// Size of the per-peer key table (0 = every peer uses the shared key)
+#ifndef STARDUST_PEER_KEYS
+    #define STARDUST_PEER_KEYS 0
+#endif
+static_assert(STARDUST_PEER_KEYS >= 0 && STARDUST_PEER_KEYS < 255, "STARDUST_PEER_KEYS must be 0..254");
+static_assert(STARDUST_PEER_KEYS == 0 || STARDUST_CIPHER_MODE != STARDUST_CIPHER_NONE, "STARDUST_PEER_KEYS needs a cipher");
+
+// Derlenen paket tipleri (STARDUST_TYPE_* bitleri). Kapalı bir tipin işleyici yuvası, istatistik sayacı, sendX/receiveX
+// fonksiyonları yoktur ve payload'ı PAYLOADSIZE'a sığmak zorunda değildir; gelen çerçevesi başlıktan sonra atlanır.
+// AGGREGATE ve TELEMETRYCOMPACT kendi ayarlarına bağlıdır.
+// Packet types compiled in (STARDUST_TYPE_* bits). A disabled type has no handler slot, no statistics counter and no
+// sendX/receiveX functions, and its payload need not fit into PAYLOADSIZE; its incoming frames are skipped after the
+// header. AGGREGATE and TELEMETRYCOMPACT follow their own settings.
+#define STARDUST_TYPE_REQUEST         0x0001
+#define STARDUST_TYPE_ACCEPT          0x0002
+#define STARDUST_TYPE_REFUSE          0x0004
+#define STARDUST_TYPE_TELEMETRY       0x0008
+#define STARDUST_TYPE_COMMAND         0x0010
+#define STARDUST_TYPE_ERROR           0x0020
+#define STARDUST_TYPE_EMERGENCY       0x0040
+#define STARDUST_TYPE_SYSTEMCOMMAND   0x0080
+#define STARDUST_TYPE_SYSTEMINFO      0x0100
+#define STARDUST_TYPE_SYSTEMHEARTBEAT 0x0200
+#define STARDUST_TYPE_BETRAYAL        0x0400
+#define STARDUST_TYPE_RELIABLE        0x0800 // RELIABLE + RELIABLEACK, StarDustReliable ve StarDustTransfer için // For StarDustReliable and StarDustTransfer
+#define STARDUST_TYPE_RELIABLEACK     0x1000
+#define STARDUST_TYPES_ALL            0x1FFF
+#ifndef STARDUST_PACKET_TYPES
+    #define STARDUST_PACKET_TYPES STARDUST_TYPES_ALL
+#endif
+#define STARDUST_HAS_TYPE(BIT) ((STARDUST_PACKET_TYPES & (BIT)) == (BIT))
+static_assert((STARDUST_PACKET_TYPES & STARDUST_TYPES_ALL) != 0, "STARDUST_PACKET_TYPES must enable at least one type");
+
+// Bağlantı istatistikleri (0 = kapalı, hiçbir sayaç ve maliyet yok)
+// Link statistics (0 = disabled, no counters and no cost)
+#ifndef STARDUST_STATS
+    #define STARDUST_STATS 0
+#endif
+
+// Çerçeve birleştirme (setAggregation): küçük mesajlar tek bir AGGREGATE çerçevesinde toplanır.
+// 0 = gönderen tarafı derlenmez (~70 byte RAM kazancı); birleştirilmiş çerçeveleri almak her zaman mümkündür
+// Frame aggregation (setAggregation): small messages are collected into one AGGREGATE frame.
+// 0 = the sending side is not compiled (saves ~70 bytes of RAM); receiving aggregated frames always works
+#ifndef STARDUST_AGGREGATION
+    #define STARDUST_AGGREGATION 1
+#endif
+
+// Sıkıştırılmış telemetri (setTelemetryCompression): aynı anda çözülebilen gönderici sayısı, 0 = kodlayıcı derlenmez
+// Compact telemetry (setTelemetryCompression): senders that can be decoded at the same time, 0 = codec not compiled
+#ifndef STARDUST_TELEMETRY_PEERS
+    #if !STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
+        #define STARDUST_TELEMETRY_PEERS 0
+    #elif defined(__AVR__)
+        #define STARDUST_TELEMETRY_PEERS 1
+    #else
+        #define STARDUST_TELEMETRY_PEERS 4
+    #endif
+#endif
+static_assert(STARDUST_TELEMETRY_PEERS >= 0 && STARDUST_TELEMETRY_PEERS < 255, "STARDUST_TELEMETRY_PEERS must be 0..254");
+static_assert(STARDUST_TELEMETRY_PEERS == 0 || STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY), "Compact telemetry needs STARDUST_TYPE_TELEMETRY");
+
+// Fark karelerinin sabit nokta ölçekleri (birim başına adım): enlem/boylam, irtifa, yaw/pitch
+// Fixed-point scales of delta frames (steps per unit): latitude/longitude, altitude, yaw/pitch
+#ifndef STARDUST_TELEMETRY_POSITION_SCALE
+    #define STARDUST_TELEMETRY_POSITION_SCALE 1e7  // ~1 cm derece başına // ~1 cm for degrees
+#endif
+#ifndef STARDUST_TELEMETRY_ALTITUDE_SCALE
+    #define STARDUST_TELEMETRY_ALTITUDE_SCALE 1e3  // mm
+#endif
+#ifndef STARDUST_TELEMETRY_ANGLE_SCALE
+    #define STARDUST_TELEMETRY_ANGLE_SCALE 1e3
+#endif
+
+// Ham çerçeve yakalama kancası (onCapture): hatta görülen her çerçeve doğrulama sonucuyla birlikte verilir
+// Raw frame capture hook (onCapture): every frame seen on the line is handed over with its validation result
+#ifndef STARDUST_CAPTURE
+    #if defined(__AVR__)
+        #define STARDUST_CAPTURE 0
+    #else
+        #define STARDUST_CAPTURE 1
+    #endif
+#endif
+
+// Bağlantılar arası yönlendirme (StarDustRouter): geçiş çerçeveleri hattaki halleriyle toplanır
+// Routing between links (StarDustRouter): transit frames are collected in their wire form
+#ifndef STARDUST_ROUTING
+    #if defined(__AVR__)
+        #define STARDUST_ROUTING 0
+    #else
+        #define STARDUST_ROUTING 1
+    #endif
+#endif
+
+// Ayrıştırma gecikmesi için saat (varsayılan mikrosaniye)
+// Clock for the parse latency (microseconds by default)
+#ifndef STARDUST_STATS_CLOCK
+    #define STARDUST_STATS_CLOCK() micros()
+#endif
+
 /* PAKET TİPLERİ */
 /* PACKET TYPES */
 enum PacketType : uint8_t { //
     REQUEST = 1, ACCEPT = 2, REFUSE = 3,
     TELEMETRY = 4, COMMAND = 5, ERROR = 101, EMERGENCY = 102,
     SYSTEMCOMMAND = 201, SYSTEMINFO = 202, SYSTEMHEARTBEAT = 203,
-    BETRAYAL = 66
+    BETRAYAL = 66,
+    RELIABLE = 10, RELIABLEACK = 11, // StarDustReliable çerçeveleri // StarDustReliable frames
+    TRANSFER = 12, // Yalnızca güvenilir mesaj tipi olarak (StarDustTransfer) // Only as a reliable message type (StarDustTransfer)
+    AGGREGATE = 13, // Birden çok alt mesaj: [tip, boyut, veri]... alıcıda ayrılır // Several sub-messages: [type, size, data]... split by the receiver
+    TELEMETRYCOMPACT = 14 // Anahtar kare veya fark kodlu telemetri, alıcıda TELEMETRY'ye çevrilir // Keyframe or delta coded telemetry, turned into TELEMETRY by the receiver
 };
 
 /* ======================================================= */
@@ -99,8 +263,93 @@ struct __attribute__((packed)) EmergencyPayload { uint8_t version; uint16_t emer
 struct __attribute__((packed)) SystemCommandPayload { uint8_t version; uint16_t commandCode; uint16_t commandParameter; uint8_t commandSenderID; uint8_t commandAuthorityLevel; };
 struct __attribute__((packed)) SystemInfoPayload { uint8_t version; uint8_t infoType; bool systemOperational; float systemLoad; float systemTemperature; float systemVoltage; uint32_t uptime; float systemErrorChance; float expectedErrorChance; float systemReliability; };
 struct __attribute__((packed)) SystemHeartbeatPayload{ uint8_t version; bool beatStatus; float systemErrorChance; float expectedErrorChance; uint8_t missedBeats; };
+// SYSTEMINFO paketi olarak gönderilen bağlantı istatistikleri; infoType alanıyla ayırt edilir
+// Link statistics sent as a SYSTEMINFO packet; told apart by the infoType field
+constexpr uint8_t STARDUST_INFO_LINK_STATS = 0xF0;
+struct __attribute__((packed)) LinkStatsPayload { uint8_t version; uint8_t infoType; uint32_t framesGood; uint32_t framesCrcError; uint32_t framesMalformed; uint32_t framesTimedOut; uint32_t framesForeign; uint32_t framesDropped; uint32_t bytesIn; uint32_t bytesOut; uint32_t resyncs; uint32_t latencyMin; uint32_t latencyAvg; uint32_t latencyMax; };
+// Saat eşleme yoklaması (StarDustTiming): SYSTEMHEARTBEAT paketi olarak gider, version alanıyla ayırt edilir.
+// PING'de transmit gönderenin saati; ECHO origin'i geri taşır, receive/transmit yanıtlayanın saatidir.
+// Clock sync probe (StarDustTiming): sent as a SYSTEMHEARTBEAT packet, told apart by the version field.
+// In a PING transmit is the sender's clock; an ECHO carries origin back, receive/transmit are the responder's clock.
+constexpr uint8_t STARDUST_HEARTBEAT_PING = 0xF0;
+constexpr uint8_t STARDUST_HEARTBEAT_ECHO = 0xF1;
+struct __attribute__((packed)) HeartbeatSyncPayload { uint8_t version; uint8_t seq; uint32_t origin; uint32_t receive; uint32_t transmit; };
+// Güvenilir teslim (StarDustReliable): sıra numarası ve iç paket tipi payload'ın başında taşınır, PacketHeader değişmez
+// Reliable delivery (StarDustReliable): sequence number and inner packet type lead the payload, PacketHeader is unchanged
+struct __attribute__((packed)) ReliableDataPayload { uint8_t seq; PacketType type; uint8_t data[PAYLOADSIZE - 2]; };
+struct __attribute__((packed)) ReliableControlPayload { uint8_t kind; uint8_t seq; uint32_t sack; };
 struct __attribute__((packed)) BetrayalPayload{ uint8_t version; bool isBetrayal; uint16_t betrayalCode; uint16_t betrayalLocation; uint8_t betrayalSeverity; bool knowsSecret; bool planExecuted; bool hasEscapePlan; bool preparedForBetrayal; float betrayalSuccessChance; float betrayalDetectionChance; bool hasAllies; uint8_t numberOfAllies; float allyLoyalty; bool knighFall; };
 
+/* ================ DAĞITIM TABLOSU =======================*/
+/* ================ DISPATCH TABLE ========================*/
+// Seyrek PacketType değerleri derleme zamanında sıkışık işleyici yuvalarına eşlenir; yalnızca derlenen tipler yuva alır
+// Sparse PacketType values are mapped to dense handler slots at compile time; only the compiled-in types get a slot
+constexpr uint8_t STARDUST_NO_HANDLER = 0xFF;    // Kütüphanenin tanımadığı tip // Type unknown to the library
+constexpr uint8_t STARDUST_TYPE_DISABLED = 0xFE; // STARDUST_PACKET_TYPES dışında // Left out of STARDUST_PACKET_TYPES
+constexpr uint8_t stardustTypeBit(size_t type) { // STARDUST_TYPE_* bit sırası // STARDUST_TYPE_* bit position
+    return type == REQUEST ? 0 : type == ACCEPT ? 1 : type == REFUSE ? 2
+         : type == TELEMETRY ? 3 : type == COMMAND ? 4 : type == ERROR ? 5
+         : type == EMERGENCY ? 6 : type == SYSTEMCOMMAND ? 7 : type == SYSTEMINFO ? 8
+         : type == SYSTEMHEARTBEAT ? 9 : type == BETRAYAL ? 10
+         : type == RELIABLE ? 11 : type == RELIABLEACK ? 12
+         : STARDUST_NO_HANDLER;
+}
+constexpr uint8_t stardustBitCount(uint32_t bits) {
+    return bits == 0 ? 0 : (uint8_t)((bits & 1) + stardustBitCount(bits >> 1));
+}
+constexpr uint8_t stardustHandlerSlot(size_t type) {
+    return stardustTypeBit(type) == STARDUST_NO_HANDLER ? STARDUST_NO_HANDLER
+         : !((STARDUST_PACKET_TYPES >> stardustTypeBit(type)) & 1) ? STARDUST_TYPE_DISABLED
+         : stardustBitCount(STARDUST_PACKET_TYPES & ((1UL << stardustTypeBit(type)) - 1));
+}
+constexpr uint8_t STARDUST_HANDLER_COUNT = stardustBitCount(STARDUST_PACKET_TYPES & STARDUST_TYPES_ALL);
+
+// 256 girişli arama tablosu: çalışma anında tek okuma (AVR'de flash'tan)
+// 256-entry lookup table: a single read at run time (from flash on AVR)
+template<typename Seq> struct StarDustHandlerTable;
+template<size_t... I> struct StarDustHandlerTable<StarDustIndices<I...> > {
+    static constexpr uint8_t slot[sizeof...(I)] STARDUST_CRC_STORAGE = { stardustHandlerSlot(I)... };
+};
+template<size_t... I>
+constexpr uint8_t StarDustHandlerTable<StarDustIndices<I...> >::slot[sizeof...(I)] STARDUST_CRC_STORAGE;
+typedef StarDustHandlerTable<StarDustMakeIndices<256>::type> StarDustHandlers;
+
+#if defined(__AVR__)
+    #define STARDUST_HANDLER_SLOT(type) pgm_read_byte(&StarDustHandlers::slot[(uint8_t)(type)])
+#else
+    #define STARDUST_HANDLER_SLOT(type) (StarDustHandlers::slot[(uint8_t)(type)])
+#endif
+
+/* ============= PAYLOAD <-> PAKET TİPİ EŞLEMESİ ==========*/
+/* ============= PAYLOAD <-> PACKET TYPE MAPPING ==========*/
+// send<T>() paket tipini payload yapısından çıkarır. Kendi payload yapılarınızı da aynı makroyla kaydedebilirsiniz.
+// send<T>() derives the packet type from the payload struct. Your own payload structs can be registered with the same macro.
+template<typename Payload> struct StarDustPayloadType;
+
+#define STARDUST_PAYLOAD_TYPE(PAYLOAD, TYPE) \
+    static_assert(sizeof(PAYLOAD) <= PAYLOADSIZE || stardustHandlerSlot(TYPE) == STARDUST_TYPE_DISABLED, \
+                  #PAYLOAD " does not fit into PAYLOADSIZE"); \
+    template<> struct StarDustPayloadType<PAYLOAD> { static constexpr PacketType type = TYPE; };
+
+STARDUST_PAYLOAD_TYPE(RequestPayload, REQUEST)
+STARDUST_PAYLOAD_TYPE(AcceptPayload, ACCEPT)
+STARDUST_PAYLOAD_TYPE(RefusePayload, REFUSE)
+STARDUST_PAYLOAD_TYPE(TelemetryPayload, TELEMETRY)
+STARDUST_PAYLOAD_TYPE(CommandPayload, COMMAND)
+STARDUST_PAYLOAD_TYPE(ErrorPayload, ERROR)
+STARDUST_PAYLOAD_TYPE(EmergencyPayload, EMERGENCY)
+STARDUST_PAYLOAD_TYPE(SystemCommandPayload, SYSTEMCOMMAND)
+STARDUST_PAYLOAD_TYPE(SystemInfoPayload, SYSTEMINFO)
+STARDUST_PAYLOAD_TYPE(SystemHeartbeatPayload, SYSTEMHEARTBEAT)
+STARDUST_PAYLOAD_TYPE(BetrayalPayload, BETRAYAL)
+STARDUST_PAYLOAD_TYPE(LinkStatsPayload, SYSTEMINFO)
+STARDUST_PAYLOAD_TYPE(HeartbeatSyncPayload, SYSTEMHEARTBEAT)
+STARDUST_PAYLOAD_TYPE(ReliableDataPayload, RELIABLE)
+STARDUST_PAYLOAD_TYPE(ReliableControlPayload, RELIABLEACK)
+// Anahtar kare, tam örneğin önüne bir byte ekler // A keyframe puts one byte in front of the full sample
+static_assert(STARDUST_TELEMETRY_PEERS == 0 || 1 + sizeof(TelemetryPayload) <= PAYLOADSIZE,
+              "Compact telemetry keyframes do not fit into PAYLOADSIZE, set STARDUST_TELEMETRY_PEERS to 0");
+
 /* =============== ORTAK PAKET YAPILARI ===================*/
 /* ============== COMMON PACKET STRUCTURES ================*/
 struct __attribute__((packed)) PacketHeader {
@@ -113,17 +362,82 @@ struct __attribute__((packed)) PacketData {
     uint16_t crc; //
 };
 
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+constexpr uint8_t STARDUST_COBS_DELIMITER = 0x00;
+constexpr uint8_t STARDUST_FRAMING_OVERHEAD = 2; // İlk kod byte'ı + ayraç // First code byte + delimiter
+#else
+constexpr uint8_t STARDUST_FRAMING_OVERHEAD = 0;
+#endif
+
+// Hattaki en uzun çerçeve // Longest frame on the wire
+constexpr uint16_t MAX_FRAME_SIZE = sizeof(PacketData) + STARDUST_FRAMING_OVERHEAD;
+
 enum class ParserState { //
-    WAIT_START, READ_HEADER, READ_PAYLOAD, READ_CRC
+    WAIT_START, READ_HEADER, READ_PAYLOAD, READ_CRC, SKIP_FRAME
+};
+
+// Adres süzgeci: hedef adresin hangi aşamada kontrol edileceği
+// Address filter: at which stage the target address is checked
+enum class AddressFilter : uint8_t {
+    VALIDATE,    // Çerçeve tamamen doğrulanır, adres en son kontrol edilir (varsayılan)
+                 // The frame is fully validated, the address is checked last (default)
+    EARLY,       // Yabancı çerçeveler başlıktan hemen sonra kopyalanmadan, çözülmeden atlanır
+                 // Foreign frames are skipped right after the header, without copy or decryption
+    PROMISCUOUS  // Hedefi ne olursa olsun tüm geçerli çerçeveler alınır (dinleyici/ağ geçidi)
+                 // Every valid frame is received whatever its target (sniffer/gateway)
+};
+
+// Yakalanan çerçevenin doğrulama sonucu (StarDustLog kayıtlarında da bu değerler saklanır)
+// Validation result of a captured frame (StarDustLog records store the same values)
+enum class CaptureResult : uint8_t {
+    VALID,       // CRC ve adres geçti // CRC and address passed
+    CRC_ERROR,
+    MALFORMED,   // Geçersiz başlık veya çerçeve ortasında kesilme // Invalid header or cut off mid-frame
+    FOREIGN,     // CRC geçti, başka adrese gidiyor // CRC passed, addressed elsewhere
+    TIMEOUT      // update() zaman aşımıyla yarıda kaldı // Cut off by the update() timeout
+};
+
+#if STARDUST_STATS
+/* ============== BAĞLANTI İSTATİSTİKLERİ =================*/
+/* ================== LINK STATISTICS =====================*/
+struct StarDustStats {
+    uint32_t framesGood;      // CRC ve adresi geçen çerçeveler        // Frames passing CRC and address
+    uint32_t framesCrcError;  // CRC hatası                             // CRC failure
+    uint32_t framesMalformed; // Geçersiz başlık (payload boyutu)       // Invalid header (payload size)
+    uint32_t framesTimedOut;  // update() zaman aşımıyla yarıda kalan   // Cut off by the update() timeout
+    uint32_t framesForeign;   // Başka adrese giden                     // Addressed elsewhere
+    uint32_t framesDropped;   // Alım kuyruğu dolu                      // Receive queue full
+    uint32_t bytesIn;
+    uint32_t bytesOut;
+    uint32_t resyncs;         // Reddedilen çerçeve içinde yeniden tarama // Rescans inside a rejected frame
+    uint32_t packetsByType[STARDUST_HANDLER_COUNT]; // stardustHandlerSlot() sırasıyla // In stardustHandlerSlot() order
+    // İlk byte'tan doğrulanmış çerçeveye kadar geçen süre (STARDUST_STATS_CLOCK birimi)
+    // Time from the first byte to the validated frame (STARDUST_STATS_CLOCK units)
+    uint32_t latencyMin;
+    uint32_t latencyMax;
+    uint32_t latencySum;
+    uint32_t latencySamples;
+
+    uint32_t latencyAvg() const { return latencySamples ? latencySum / latencySamples : 0; }
 };
+#endif
+
+#if STARDUST_ROUTING
+class StarDustRouter;
+#endif
 
 /* ======================================================= */
 /* =================== STARDUST SINIFI ====================*/
 /* =================== STARDUST CLASS =====================*/
 /* ======================================================= */
-class StarDust {
+// Protokol çekirdeği. Alım yuvaları, toplama tamponu ve anahtar çizelgesi örneğe aittir ve StarDustT
+// tarafından sağlanır; modüller (StarDustReliable, StarDustRouter...) her örneğe StarDustCore& ile bağlanır.
+// Protocol core. The receive slots, the aggregation buffer and the key schedule belong to the instance and are
+// provided by StarDustT; the modules (StarDustReliable, StarDustRouter...) bind to any instance via StarDustCore&.
+class StarDustCore {
 public:
-    StarDust();
+    StarDustCore(const StarDustCore&) = delete;
+    StarDustCore& operator=(const StarDustCore&) = delete;
 
     // Sistemi Başlatma
     // Initialize the system
@@ -131,66 +445,475 @@ public:
     
     // Güvenlik ve Ayarlar
     void setCryptoKey(const uint8_t* newKey);
+#if STARDUST_PEER_KEYS > 0
+    // Eşe özel anahtar: gönderimde hedef ID'ye, alımda kaynak ID'ye göre seçilir (nullptr = kaldır)
+    // Peer specific key: chosen by target ID when sending, by source ID when receiving (nullptr = remove)
+    bool setPeerKey(uint8_t peerID, const uint8_t* key);
+#endif
     void setTimeout(uint32_t timeoutMs);      // Okuma için timeout süresi belirleme
                                               // Set timeout duration for reading
+    // Kaynağa özel çerçeve zaman aşımı: başlık okunduktan sonra sorulur, 0 = setTimeout() süresi (ör. StarDustTiming)
+    // Per-source frame timeout: asked once the header is read, 0 = the setTimeout() value (e.g. StarDustTiming)
+    typedef uint32_t (*PeerTimeout)(uint8_t source, void* context);
+    void setPeerTimeout(PeerTimeout timeout, void* context = nullptr); // nullptr = kapalı // nullptr = off
 
     void setTargetID(uint8_t targetID);       // İletişim kurulacak hedefi/slave'i değiştir
                                               // Change the target/slave to communicate with
+    uint8_t getID() const;                    // Bu düğümün ID'si // ID of this node
+    uint8_t maxPayload() const { return _maxPayload; } // Bu örneğin taşıdığı en uzun payload // Longest payload this instance carries
+
+    void setAddressFilter(AddressFilter mode); // Adres süzgeci kipi // Address filter mode
+    void acceptAddress(uint8_t id, bool accept = true); // Grup adresi ekle/çıkar // Add/remove a group address
+
+    void setByteBudget(uint16_t maxBytes);    // update() başına okunacak azami byte (0 = sınırsız)
+                                              // Maximum bytes read per update() (0 = unlimited)
 
     // Ana Döngü Güncellemesi (Non-blocking Okuma)
     // Main loop update (Non-blocking reading)
-    bool update(PacketData& outPacket);
+    bool update(PacketData& outPacket);       // Okur ve kuyruktaki en eski paketi verir // Reads and returns the oldest queued packet
+    uint8_t update();                         // Yalnızca okur ve kuyruğa ekler          // Only reads and fills the queue
+
+#if STARDUST_FEED_BUFFER_SIZE > 0
+    // UART RX kesmesi veya DMA geri çağrısından toplu byte besleme (tek üretici)
+    // Bulk byte feed from a UART RX interrupt or DMA callback (single producer)
+    // Kabul edilen byte sayısını döndürür, bayt'lar bir sonraki update() çağrısında ayrıştırılır
+    // Returns the number of accepted bytes, they are parsed by the next update() call
+    size_t feed(const uint8_t* data, size_t len);
+#endif
+
+    // ==== ALIM KUYRUĞU ====
+    // ==== RECEIVE QUEUE ====
+    uint8_t available() const;                // Kuyruktaki paket sayısı                 // Number of queued packets
+    bool pop(PacketData& outPacket);          // En eski paketi kuyruktan alır           // Takes the oldest packet from the queue
+    // peek() kuyruk yuvasını gösterir: payload yalnızca maxPayload() byte'a kadar geçerlidir, crc alanı kullanılmaz
+    // peek() shows the queue slot: the payload is valid up to maxPayload() bytes only, the crc field is not used
+    const PacketData* peek() const;           // En eski pakete kopyasız erişim          // Copy-free access to the oldest packet
+    uint32_t droppedPackets() const;          // Kuyruk dolu olduğu için atılan paketler // Packets dropped because the queue was full
+
+    // ==== TİPLİ İŞLEYİCİLER ====
+    // ==== TYPED HANDLERS ====
+    // İşleyici, kuyruktaki doğrulanmış pakete kopyasız bir görünüm alır; görünüm işleyici dönene kadar geçerlidir.
+    // İşleyici içinde pop() çağrılmamalıdır, gönderim ve update() serbesttir.
+    // The handler gets a copy-free view of the validated packet in the queue; the view is valid until the handler returns.
+    // Do not call pop() from a handler, sending and update() are fine.
+    //   slave.onPacket<COMMAND>(onCommand);  // void onCommand(const CommandPayload&, const PacketHeader&, void*)
+    template<PacketType TYPE, typename Payload>
+    void onPacket(void (*handler)(const Payload& payload, const PacketHeader& header, void* context), void* context = nullptr) {
+        static_assert(sizeof(Payload) <= PAYLOADSIZE, "Payload does not fit into PAYLOADSIZE");
+        static_assert(stardustHandlerSlot(TYPE) != STARDUST_NO_HANDLER, "PacketType has no dispatch slot");
+        static_assert(stardustHandlerSlot(TYPE) != STARDUST_TYPE_DISABLED, "PacketType is not in STARDUST_PACKET_TYPES");
+        HandlerEntry& entry = _handlers[stardustHandlerSlot(TYPE)];
+        entry.invoke = &invokeHandler<Payload>;
+        entry.handler = reinterpret_cast<void (*)()>(handler);
+        entry.context = context;
+    }
+    void removeHandler(PacketType type);
+    void onUnhandled(void (*handler)(const PacketData& packet, void* context), void* context = nullptr); // İşleyicisi olmayan paketler // Packets without a handler
+    // Her paket, işleyicisinden önce bu gözlemciye gösterilir (ör. StarDustScheduler yanıtları böyle görür)
+    // Every packet is shown to this observer before its handler (e.g. StarDustScheduler sees responses this way)
+    void onDispatch(void (*observer)(const PacketData& packet, void* context), void* context = nullptr);
+    uint8_t dispatch();                       // update() + kuyruktaki tüm paketleri dağıtır // update() + dispatches every queued packet
+
+#if STARDUST_CAPTURE
+    // ==== ÇERÇEVE YAKALAMA ====
+    // ==== FRAME CAPTURE ====
+    // Kanca, ayrıştırıcının bitirdiği veya reddettiği her çerçevenin hattaki byte'larını (şifreli, çerçevelemeyle)
+    // update() içinden alır. AddressFilter::EARLY ile atlanan yabancı çerçeveler okunmadığı için yakalanmaz.
+    // The hook receives the wire bytes (encrypted, with framing) of every frame the parser completes or rejects,
+    // from inside update(). Foreign frames skipped by AddressFilter::EARLY are not read and so not captured.
+    typedef void (*CaptureHook)(const uint8_t* frame, uint8_t length, CaptureResult result, void* context);
+    void onCapture(CaptureHook hook, void* context = nullptr); // nullptr = kapalı // nullptr = off
+#endif
+
+#if STARDUST_STATS
+    // ==== BAĞLANTI İSTATİSTİKLERİ ====
+    // ==== LINK STATISTICS ====
+    const StarDustStats& stats() const;
+    uint32_t packetsOfType(PacketType type) const;   // Alınan geçerli paketler // Valid packets received
+    void resetStats();
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+    bool sendLinkStats();                     // İstatistikleri SYSTEMINFO olarak hedefe gönderir // Sends the statistics to the target as SYSTEMINFO
+    void setStatsInterval(uint32_t intervalMs); // update() bu aralıkla sendLinkStats() çağırır (0 = kapalı) // update() calls sendLinkStats() at this interval (0 = off)
+#endif
+#endif
 
     // ==== GÖNDERİM FONKSİYONLARI ====
     // ==== TRANSMISSION FUNCTIONS ====
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
     PacketData sendRequest(uint8_t version, uint8_t requestType, bool isCritical); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
     PacketData sendAccept(uint8_t version, uint8_t acceptType, bool accepted); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
     PacketData sendRefuse(uint8_t version, uint8_t refuseType, bool refused); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
     PacketData sendTelemetry(uint8_t version, double latitude, double longitude, double altitude, float yaw, float pitch, uint32_t timestamp, uint8_t status); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
     PacketData sendCommand(uint8_t version,double targetLat,double targetLon,float targetAlt,uint8_t actionCode); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
     PacketData sendError(uint8_t version, uint16_t errorCode, uint16_t errorLocation, uint8_t errorSeverity); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
     PacketData sendEmergency(uint8_t version, uint16_t emergencyCode, uint16_t emergencyLocation, uint8_t emergencySeverity); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
     PacketData sendSystemCommand(uint8_t version, uint16_t commandCode, uint16_t commandParameter, uint8_t commandSenderID, uint8_t commandAuthorityLevel); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
     PacketData sendSystemInfo(uint8_t version, uint8_t infoType, bool systemOperational, float systemLoad, float systemTemperature, float systemVoltage, uint32_t uptime, float systemErrorChance, float expectedErrorChance, float systemReliability); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
     PacketData sendSystemHeartbeat(uint8_t version, bool beatStatus, float systemErrorChance, float expectedErrorChance, uint8_t missedBeats); //
+#endif
+    // Genel gönderim: çerçeve doğrudan gönderim kuyruğu yuvasında kurulur ve şifrelenir (ara PacketData yok)
+    // Generic send: the frame is built and encrypted directly in a transmit queue slot (no intermediate PacketData)
+    bool sendPayload(PacketType type, const void* payload, uint8_t size);
+    bool sendPayload(uint8_t target, PacketType type, const void* payload, uint8_t size); // Hedef ID çağrı başına // Target ID per call
+#if STARDUST_AGGREGATION
+    // Açıkken küçük mesajlar (EMERGENCY hariç) aynı hedefe giden tek bir AGGREGATE çerçevesinde toplanır. Çerçeve
+    // dolunca, hedef değişince, birleştirilemeyen bir mesaj gönderilince veya delayMs dolunca (update()) gönderilir.
+    // Sıra korunur. Toplama tamponu kilitsizdir: açıkken tek görevden gönderin.
+    // When enabled small messages (except EMERGENCY) to the same target are collected into one AGGREGATE frame. It is
+    // sent when full, when the target changes, when a message that cannot be batched is sent or after delayMs (update()).
+    // Order is kept. The batch buffer has no lock: send from a single task while it is enabled.
+    void setAggregation(bool enabled, uint16_t delayMs = 0);
+    bool flushBatch();                        // Bekleyen toplamayı hemen gönderir // Sends the pending batch now
+#endif
+#if STARDUST_TELEMETRY_PEERS > 0
+    // Açıkken TELEMETRY, TELEMETRYCOMPACT olarak gider: her keyframeInterval örnekte bir tam anahtar kare, arada
+    // anahtar kareye göre sabit nokta farklar (zigzag + varint). Alıcı yeniden TelemetryPayload kurar; farklar
+    // en fazla yarım ölçek adımı kadar yuvarlanır. Anahtar karesi kaybolan alıcı yenisini ister.
+    // When enabled TELEMETRY goes out as TELEMETRYCOMPACT: a full keyframe every keyframeInterval samples, in between
+    // fixed-point deltas against the keyframe (zigzag + varint). The receiver rebuilds a TelemetryPayload; deltas are
+    // rounded to at most half a scale step. A receiver that lost the keyframe asks for a new one.
+    void setTelemetryCompression(bool enabled, uint8_t keyframeInterval = 10);
+    uint32_t telemetryMissed() const;         // Anahtar karesi olmadığı için atılan farklar // Deltas dropped for lack of their keyframe
+#endif
+    // Tipli gönderim: paket tipi payload yapısından çıkarılır, kopya döndürülmez
+    // Typed send: the packet type is taken from the payload struct, no copy is returned
+    template<typename Payload>
+    bool send(const Payload& payload) {
+        static_assert(sizeof(Payload) <= PAYLOADSIZE, "Payload does not fit into PAYLOADSIZE");
+        static_assert(stardustHandlerSlot(StarDustPayloadType<Payload>::type) != STARDUST_TYPE_DISABLED,
+                      "PacketType is not in STARDUST_PACKET_TYPES");
+        return sendPayload(StarDustPayloadType<Payload>::type, &payload, sizeof(Payload));
+    }
+    template<PacketType TYPE, typename Payload>
+    bool send(const Payload& payload) {
+        static_assert(sizeof(Payload) <= PAYLOADSIZE, "Payload does not fit into PAYLOADSIZE");
+        static_assert(stardustHandlerSlot(TYPE) != STARDUST_TYPE_DISABLED, "PacketType is not in STARDUST_PACKET_TYPES");
+        return sendPayload(TYPE, &payload, sizeof(Payload));
+    }
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
     PacketData sendBetrayal(uint8_t version, bool isBetrayal, uint16_t betrayalCode, uint16_t betrayalLocation, uint8_t betrayalSeverity, bool knowsSecret, bool planExecuted, bool hasEscapePlan, bool preparedForBetrayal, float betrayalSuccessChance, float betrayalDetectionChance, bool hasAllies, uint8_t numberOfAllies, float allyLoyalty, bool knighFall); //
+#endif
+
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    // ==== GÖNDERİM KUYRUĞU ====
+    // ==== TRANSMIT QUEUE ====
+    // EMERGENCY/ERROR/SYSTEMCOMMAND öncelikli şeritten, diğerleri normal şeritten gönderilir.
+    // Başlamış bir çerçeve bölünmez; sonraki çerçeve her zaman önce öncelikli şeritten seçilir.
+    // Birden çok RTOS görevi aynı anda gönderebilir: her görev kilitsiz bir yuva ayırır, tek yazıcı sırayla boşaltır.
+    // EMERGENCY/ERROR/SYSTEMCOMMAND use the priority lane, the rest the normal lane.
+    // A frame that has started is never split; the next frame is always taken from the priority lane first.
+    // Several RTOS tasks may send at once: each task reserves a slot lock-free, a single writer drains them in order.
+    uint8_t flushTx();                        // Portun kabul ettiği kadar yazar (update() da çağırır) // Writes as much as the port accepts (also called by update())
+    void setTxBurst(uint8_t maxBytes);        // availableForWrite() bildirmeyen portlar için çağrı başına byte // Bytes per call for ports that do not report availableForWrite()
+    uint8_t txQueued() const;                 // Bekleyen çerçeve sayısı                // Number of waiting frames
+    uint8_t txHighWater() const;              // Görülen en yüksek doluluk               // Highest fill level seen
+    uint32_t txDropped() const;               // Kuyruk dolu olduğu için atılan çerçeveler // Frames dropped because the queue was full
+#endif
 
     // ==== ALIM FONKSİYONLARI ====
     // ==== RECEPTION FUNCTIONS ===
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REQUEST)
     RequestPayload receiveRequest(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ACCEPT)
     AcceptPayload receiveAccept(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_REFUSE)
     RefusePayload receiveRefuse(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_TELEMETRY)
     TelemetryPayload receiveTelemetry(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_COMMAND)
     CommandPayload receiveCommand(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_ERROR)
     ErrorPayload receiveError(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_EMERGENCY)
     EmergencyPayload receiveEmergency(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMCOMMAND)
     SystemCommandPayload receiveSystemCommand(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
     SystemInfoPayload receiveSystemInfo(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
     SystemHeartbeatPayload receiveSystemHeartbeat(const PacketData& packet); //
+#endif
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_BETRAYAL)
     BetrayalPayload receiveBetrayal(const PacketData& packet); //
+#endif
+
+protected:
+    // Depo StarDustT'den gelir (stardustStorageSize(maxPayload) byte); key nullptr ise bu örnek şifresizdir
+    // Storage comes from StarDustT (stardustStorageSize(maxPayload) bytes); a nullptr key leaves this instance unencrypted
+    StarDustCore(uint8_t* storage, uint8_t maxPayload, StarDustCipher::Schedule* key);
 
 private:
     Stream* _port;
     uint8_t _myID;
     uint8_t _targetID;
-    uint8_t _cryptoKey[16];
+    uint8_t _maxPayload;
+    StarDustCipher::Schedule* _cipher;      // Ortak anahtarın çizelgesi (nullptr = şifresiz) // Schedule of the shared key (nullptr = plain)
+#if STARDUST_PEER_KEYS > 0
+    StarDustCipher::Schedule _peerKeys[STARDUST_PEER_KEYS];
+    uint8_t _peerSlot[256];                 // Eş ID -> yuva + 1 (0 = ortak anahtar) // Peer ID -> slot + 1 (0 = shared key)
+    uint8_t _peerOwner[STARDUST_PEER_KEYS]; // Yuvayı kullanan eş ID // Peer ID using the slot
+#endif
+    const StarDustCipher::Schedule* _rxKey; // Ayrıştırılan çerçevenin anahtarı // Key of the frame being parsed
+    AddressFilter _addressFilter;
+    uint8_t _addressMask[32]; // Kabul edilen hedef ID'ler (256 bit) // Accepted target IDs (256 bits)
 
     // Parser State (RTOS Uyumlu İzole Değişkenler)
     // Parser State (Isolated Variables for RTOS Compatibility)
     ParserState _state;
     uint16_t _bytesRead;
-    uint8_t _rxBuffer[sizeof(PacketData)]; 
+    uint8_t _rxPayloadLength; // Hatta taşınan payload uzunluğu // Payload length carried on the wire
+    uint16_t _rxCrc;          // Byte byte güncellenen CRC     // CRC updated byte by byte
+    uint8_t _skipRemaining;   // Atlanan çerçevenin kalan byte'ları // Bytes left of the skipped frame
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+    uint8_t _cobsRun;         // Bloğun kalan veri byte'ları (0 = sıradaki byte kod) // Data bytes left in the block (0 = next byte is a code)
+    bool _cobsZero;           // Blok bir sıfırla biter // The block ends with a zero
+    bool _cobsSync;           // false: sıradaki ayraca kadar atlanır // false: skipping up to the next delimiter
+#endif
+    uint8_t* _rxBuffer;       // Kuyruktaki boş yuvaya işaret eder // Points at the free slot of the queue
     uint32_t _lastRxTime;
     uint32_t _timeoutMs;
+    PeerTimeout _peerTimeout;
+    void* _peerTimeoutContext;
+    uint16_t _byteBudget;
+
+    // Alım Kuyruğu: paket doğrudan boş yuvada kurulur, fazladan bir yuva çalışma tamponudur.
+    // Yuvalar PacketData düzenindedir ama payload yalnızca maxPayload byte'tır, CRC hemen ardından gelir.
+    // Receive Queue: packets are built in place in the free slot, the extra slot is the working buffer.
+    // Slots have the PacketData layout but the payload is only maxPayload bytes, the CRC follows right after it.
+    uint8_t* _rxSlots;
+    uint8_t _rxSlotSize;
+    uint8_t _rxHead;
+    uint8_t _rxCount;
+    uint16_t _rxExtra;        // Kuyruktaki toplama çerçevelerinde henüz açılmamış kayıtlar // Records not yet unpacked in queued aggregate frames
+    uint8_t _rxRest;          // Baş yuvanın sonunda bekleyen kayıt byte'ları // Record bytes waiting at the end of the head slot
+    uint32_t _rxDropped;
+
+#if STARDUST_FEED_BUFFER_SIZE > 0
+    StarDustByteRing<STARDUST_FEED_BUFFER_SIZE> _feedRing;
+#endif
+
+#if STARDUST_STATS
+    StarDustStats _stats;
+    uint32_t _rxStartTime;    // Çerçevenin ilk byte'ının zamanı // Time of the first byte of the frame
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMINFO)
+    uint32_t _statsInterval;
+    uint32_t _statsLastReport;
+#endif
+#endif
+
+#if STARDUST_AGGREGATION
+    // Toplanan alt mesajlar, AGGREGATE payload'ının hattaki haliyle // Collected sub-messages, as the AGGREGATE payload on the wire
+    uint8_t* _batch;
+    uint8_t _batchLength;
+    uint8_t _batchCount;
+    uint8_t _batchTarget;
+    bool _batchEnabled;
+    uint16_t _batchDelay;
+    uint32_t _batchStart;
+#endif
+
+#if STARDUST_TELEMETRY_PEERS > 0
+    // Gönderen: son anahtar kare // Sender: the last keyframe
+    TelemetryPayload _teleKey;
+    uint8_t _teleKeyId;
+    uint8_t _teleSinceKey;
+    uint8_t _teleInterval;        // 0 = kapalı // 0 = disabled
+    uint8_t _teleTarget;
+    bool _teleForceKey;           // Alıcı anahtar kare istedi // A receiver asked for a keyframe
+    // Alıcı: gönderici başına son anahtar kare // Receiver: the last keyframe per sender
+    struct TelemetryPeer {
+        uint8_t source;
+        uint8_t keyId;            // 0xFF = yok // 0xFF = none
+        uint8_t requested;        // İstenen son anahtar kare // Last keyframe asked for
+        bool used;
+        TelemetryPayload key;
+    };
+    TelemetryPeer _telePeers[STARDUST_TELEMETRY_PEERS];
+    uint8_t _teleVictim;
+    uint32_t _teleMissed;
+#endif
+
+    // İşleyici tablosu: invoke, silinmiş işleyici işaretçisini gerçek payload tipine geri çevirir
+    // Handler table: invoke casts the erased handler pointer back to the real payload type
+    struct HandlerEntry {
+        void (*invoke)(void (*handler)(), const PacketData& packet, void* context);
+        void (*handler)();
+        void* context;
+    };
+    HandlerEntry _handlers[STARDUST_HANDLER_COUNT];
+    void (*_unhandled)(const PacketData& packet, void* context);
+    void* _unhandledContext;
+    void (*_observer)(const PacketData& packet, void* context);
+    void* _observerContext;
+#if STARDUST_CAPTURE
+    CaptureHook _capture;
+    void* _captureContext;
+#endif
+#if STARDUST_ROUTING
+    // Yönlendirici, bağlı olduğu portların anahtarlarına ve gönderim yoluna erişir
+    // The router reaches the keys and the transmit path of the ports bound to it
+    friend class StarDustRouter;
+    StarDustRouter* _router;  // nullptr = yönlendiriciye bağlı değil // nullptr = not bound to a router
+    uint8_t _routerPort;      // Yönlendiricideki port numarası // Port number in the router
+    bool _transit;            // Ayrıştırılan çerçeve geçişte: payload çözülmeden tutulur // The frame being parsed is in transit: its payload is kept encrypted
+#endif
+
+    template<typename Payload>
+    static void invokeHandler(void (*handler)(), const PacketData& packet, void* context) {
+        reinterpret_cast<void (*)(const Payload&, const PacketHeader&, void*)>(handler)(
+            *reinterpret_cast<const Payload*>(packet.payload), packet.header, context);
+    }
+
+#if STARDUST_TX_QUEUE_DEPTH > 0
+    // Gönderim Kuyruğu: çerçeveler hattaki halleriyle saklanır
+    // Transmit Queue: frames are stored as they appear on the wire
+    struct TxFrame { uint8_t length; uint8_t bytes[MAX_FRAME_SIZE]; };
+    enum : uint8_t { TX_LANE_PRIORITY = 0, TX_LANE_NORMAL = 1, TX_LANES = 2, TX_IDLE = 0xFF };
+    StarDustSlotRing<TxFrame, STARDUST_TX_QUEUE_DEPTH> _txLanes[TX_LANES];
+    uint8_t _txActiveLane;    // Yazılmakta olan çerçevenin şeridi // Lane of the frame being written
+    uint8_t _txOffset;        // O çerçevenin yazılan byte'ları     // Bytes of that frame already written
+    uint8_t _txBurst;
+    uint8_t _txHighWater;
+    uint8_t _txWriting;       // Tek yazıcı bayrağı (bekleme yok, yalnızca deneme) // Single writer flag (no waiting, try only)
+    uint32_t _txDropped;
+
+    static uint8_t txLane(PacketType type);
+    TxFrame* reserveTx(PacketType type);
+    void publishTx(PacketType type, TxFrame* slot);
+    uint8_t drainTx();
+#endif
 
     // Yardımcı İç Fonksiyonlar
     // Helper Internal Functions
     uint16_t calculateCRC16CCITT(const uint8_t *data, uint16_t length); //
-    void encryptPayload(uint8_t* payload, uint8_t size); //
-    void decryptPayload(uint8_t* payload, uint8_t size); //
-    bool validatePacket(PacketData* packet);
+    const StarDustCipher::Schedule* keyFor(uint8_t peerID) const;
+    void encryptPayload(uint8_t* payload, uint8_t size, const StarDustCipher::Schedule* key); //
+    void decryptPayload(uint8_t* payload, uint8_t size, uint8_t offset, const StarDustCipher::Schedule* key); //
+    bool validatePacket(const PacketData* packet);
     void preparePacket(PacketData& packet, PacketType type, const uint8_t* payloadData, uint8_t payloadSize);
-    bool parseByte(uint8_t incomingByte, PacketData& outPacket);
+    void writePacket(const PacketData& packet);
+    void emitPacket(const PacketData& packet, const void* payload);
+    bool sendFrame(uint8_t target, PacketType type, const uint8_t* payload, uint8_t size);
+#if STARDUST_AGGREGATION
+    bool batchPayload(uint8_t target, PacketType type, const uint8_t* payload, uint8_t size);
+#endif
+    static uint8_t serializePacket(const PacketData& packet, uint8_t* out);
+    uint8_t buildFrame(uint8_t* out, uint8_t target, PacketType type, const uint8_t* payloadData, uint8_t payloadSize);
+    static uint8_t wirePayloadSize(uint8_t payloadSize);
+    enum class ParseResult : uint8_t { NONE, PACKET, FAILED };
+    ParseResult parseByte(uint8_t incomingByte);
+    void parseBytes(const uint8_t* data, size_t length);
+    size_t readPayload(const uint8_t* data, size_t length);
+    size_t skipBytes(size_t length);
+    bool isAccepted(uint8_t target) const;
+    uint32_t frameTimeout() const;
+#if STARDUST_FRAMING == STARDUST_FRAMING_COBS
+    static uint8_t finishFrame(uint8_t* out, uint8_t length);
+    void cobsByte(uint8_t decoded);
+    void beginCobsFrame();
+#else
+    static uint8_t finishFrame(uint8_t*, uint8_t length) { return length; }
+    void resync();
+#endif
+    uint8_t rawFrame(uint8_t* out);
+#if STARDUST_ROUTING
+    bool isTransit() const { return _transit; }
+    bool isRouted() const { return _router != nullptr; }
+    void forwardFrame();
+    bool sendRaw(const uint8_t* frame, uint8_t length);
+#else
+    bool isTransit() const { return false; }
+    bool isRouted() const { return false; }
+#endif
+#if STARDUST_CAPTURE
+    void captureFrame(CaptureResult result);
+#endif
+    PacketData& rxSlot(uint8_t index) const { return *(PacketData*)(_rxSlots + index * _rxSlotSize); }
+    uint8_t* slotCrc(uint8_t* slot) const { return slot + sizeof(PacketHeader) + _maxPayload; }
+    void copySlot(const PacketData& slot, PacketData& out) const;
+    bool commitPacket();
+    uint8_t countRecords(PacketData& packet);
+    void expandHead();
+    void advanceHead();
+    void stepHead();
+    void settleHead();
+#if STARDUST_TELEMETRY_PEERS > 0
+    uint8_t encodeTelemetry(uint8_t target, const TelemetryPayload& sample, uint8_t* out);
+    bool decodeTelemetry(PacketData& packet);
+    TelemetryPeer* telemetryPeer(uint8_t source, bool create);
+#endif
+#if STARDUST_STATS
+    void recordFrame(PacketType type);
+#endif
+};
+
+/* ======================================================= */
+/* ================= ÖRNEK BAŞINA AYARLAR =================*/
+/* ================= PER-INSTANCE SETTINGS ================*/
+/* ======================================================= */
+// Örnek deposu: alım yuvaları ve ardından toplama tamponu // Instance storage: the receive slots followed by the aggregation buffer
+constexpr uint16_t stardustStorageSize(uint8_t maxPayload) {
+    return (STARDUST_RX_QUEUE_DEPTH + 1) * (sizeof(PacketHeader) + maxPayload + sizeof(uint16_t))
+           + (STARDUST_AGGREGATION ? maxPayload : 0);
+}
+
+template<bool Crypto> struct StarDustKeyStorage {
+    StarDustCipher::Schedule schedule;
+    static StarDustCipher::Schedule* of(StarDustKeyStorage& storage) { return &storage.schedule; }
+};
+template<> struct StarDustKeyStorage<false> {
+    static StarDustCipher::Schedule* of(StarDustKeyStorage&) { return nullptr; }
 };
 
+// MaxPayload: bu bağlantının alıp gönderdiği en uzun payload (alım kuyruğu ve toplama tamponu buna göre ayrılır).
+// Crypto: false ise bu bağlantı şifresizdir ve anahtar çizelgesi için yer ayrılmaz.
+// Paket tipleri, CRC/şifre motoru, kuyruk derinlikleri ve STARDUST_PAYLOAD_SIZE derleme genelinde kalır.
+// MaxPayload: longest payload this link receives and sends (the receive queue and aggregation buffer are sized by it).
+// Crypto: with false this link is unencrypted and no room is taken for a key schedule.
+// Packet types, the CRC/cipher engines, queue depths and STARDUST_PAYLOAD_SIZE stay build-wide.
+template<uint8_t MaxPayload = PAYLOADSIZE, bool Crypto = (STARDUST_CIPHER_MODE != STARDUST_CIPHER_NONE)>
+class StarDustT : public StarDustCore {
+    static_assert(MaxPayload > 0 && MaxPayload <= PAYLOADSIZE, "MaxPayload must be between 1 and PAYLOADSIZE");
+    static_assert(STARDUST_VARIABLE_FRAMES || MaxPayload == PAYLOADSIZE,
+                  "Fixed frames always carry PAYLOADSIZE bytes, MaxPayload cannot be smaller");
+
+public:
+    StarDustT() : StarDustCore(_storage, MaxPayload, StarDustKeyStorage<Crypto>::of(_key)) {}
+
+private:
+    uint8_t _storage[stardustStorageSize(MaxPayload)];
+    StarDustKeyStorage<Crypto> _key;
+};
+
+// Varsayılan örnek: derleme genelindeki ayarlar // Default instance: the build-wide settings
+typedef StarDustT<> StarDust;
+
 #endif
@@ -0,0 +1,244 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust CRC16-CCITT Engine
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Table driven CRC16-CCITT (poly 0x1021, init 0xFFFF) used by the StarDust protocol.
+All lookup tables are generated at compile time with constexpr, the engine is
+selected with STARDUST_CRC_MODE and offers an incremental API for byte-wise parsers.
+StarDustCRC32 (IEEE 802.3, as in zlib) protects whole objects sent by StarDustTransfer.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_CRC_H
+#define STARDUST_CRC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#endif
+
+/* CRC MOTORU SEÇENEKLERİ */
+/* CRC ENGINE OPTIONS */
+#define STARDUST_CRC_BITWISE 0 // Tablosuz, 8 iterasyon/byte       // No table, 8 iterations/byte
+#define STARDUST_CRC_NIBBLE  1 // 16 girişli tablo (32 byte)       // 16-entry table (32 bytes)
+#define STARDUST_CRC_TABLE   2 // 256 girişli tablo (512 byte)     // 256-entry table (512 bytes)
+#define STARDUST_CRC_SLICE4  3 // 4 x 256 tablo (2 KB)             // 4 x 256 tables (2 KB)
+#define STARDUST_CRC_SLICE8  4 // 8 x 256 tablo (4 KB)             // 8 x 256 tables (4 KB)
+
+#ifndef STARDUST_CRC_MODE
+    #if defined(__AVR__)
+        #define STARDUST_CRC_MODE STARDUST_CRC_NIBBLE  // AVR flash bütçesi // AVR flash budget
+    #elif defined(ARDUINO)
+        #define STARDUST_CRC_MODE STARDUST_CRC_SLICE4  // ESP32, STM32, RP2040...
+    #else
+        #define STARDUST_CRC_MODE STARDUST_CRC_SLICE8  // PC / Host
+    #endif
+#endif
+
+// AVR'de tablolar flash'ta (PROGMEM) tutulur, diğer platformlarda const veri zaten flash'tadır
+// On AVR the tables live in flash (PROGMEM), on other platforms const data is already in flash
+#if defined(__AVR__)
+    #define STARDUST_CRC_STORAGE PROGMEM
+    #define STARDUST_CRC_READ(table, index) pgm_read_word(&(table)[index])
+    #define STARDUST_CRC_READ32(table, index) pgm_read_dword(&(table)[index])
+#else
+    #define STARDUST_CRC_STORAGE
+    #define STARDUST_CRC_READ(table, index) ((table)[index])
+    #define STARDUST_CRC_READ32(table, index) ((table)[index])
+#endif
+
+// Derleme zamanı indeks dizisi (C++11'de std::index_sequence yok, AVR'de <utility> da yok)
+// Compile-time index sequence (C++11 has no std::index_sequence, AVR has no <utility> either)
+template<size_t... I> struct StarDustIndices {};
+template<size_t N, size_t... I> struct StarDustMakeIndices : StarDustMakeIndices<N - 1, N - 1, I...> {};
+template<size_t... I> struct StarDustMakeIndices<0, I...> { typedef StarDustIndices<I...> type; };
+
+namespace StarDustCRCTables {
+    constexpr uint16_t POLY = 0x1021; //
+
+    // Derleme zamanı tablo üreticileri (C++11 constexpr, tek return ifadesi)
+    // Compile-time table generators (C++11 constexpr, single return statement)
+    constexpr uint16_t shift(uint16_t crc, uint8_t bits) {
+        return bits == 0 ? crc
+             : shift((crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ POLY) : static_cast<uint16_t>(crc << 1), bits - 1);
+    }
+    constexpr uint16_t nibbleEntry(size_t index) {
+        return shift(static_cast<uint16_t>(index << 12), 4);
+    }
+    constexpr uint16_t sliceEntry(size_t slice, size_t index) {
+        return slice == 0 ? shift(static_cast<uint16_t>(index << 8), 8)
+             : static_cast<uint16_t>((sliceEntry(slice - 1, index) << 8) ^ sliceEntry(0, sliceEntry(slice - 1, index) >> 8));
+    }
+
+    template<typename Seq> struct NibbleTable;
+    template<size_t... I> struct NibbleTable<StarDustIndices<I...> > {
+        static constexpr uint16_t data[sizeof...(I)] STARDUST_CRC_STORAGE = { nibbleEntry(I)... };
+    };
+    template<size_t... I>
+    constexpr uint16_t NibbleTable<StarDustIndices<I...> >::data[sizeof...(I)] STARDUST_CRC_STORAGE;
+
+    template<size_t S, typename Seq> struct SliceTable;
+    template<size_t S, size_t... I> struct SliceTable<S, StarDustIndices<I...> > {
+        static constexpr uint16_t data[sizeof...(I)] STARDUST_CRC_STORAGE = { sliceEntry(S, I)... };
+    };
+    template<size_t S, size_t... I>
+    constexpr uint16_t SliceTable<S, StarDustIndices<I...> >::data[sizeof...(I)] STARDUST_CRC_STORAGE;
+
+    typedef NibbleTable<StarDustMakeIndices<16>::type> Nibble;
+    template<size_t S> struct Slice : SliceTable<S, StarDustMakeIndices<256>::type> {};
+
+    // CRC32: yansıtılmış (LSB önce) polinom // CRC32: reflected (LSB first) polynomial
+    constexpr uint32_t POLY32 = 0xEDB88320;
+    constexpr uint32_t shift32(uint32_t crc, uint8_t bits) {
+        return bits == 0 ? crc : shift32((crc & 1) ? (crc >> 1) ^ POLY32 : crc >> 1, bits - 1);
+    }
+
+    template<uint8_t BITS, typename Seq> struct Table32;
+    template<uint8_t BITS, size_t... I> struct Table32<BITS, StarDustIndices<I...> > {
+        static constexpr uint32_t data[sizeof...(I)] STARDUST_CRC_STORAGE = { shift32(I, BITS)... };
+    };
+    template<uint8_t BITS, size_t... I>
+    constexpr uint32_t Table32<BITS, StarDustIndices<I...> >::data[sizeof...(I)] STARDUST_CRC_STORAGE;
+
+    typedef Table32<4, StarDustMakeIndices<16>::type> Nibble32;
+    typedef Table32<8, StarDustMakeIndices<256>::type> Byte32;
+}
+
+class StarDustCRC {
+public:
+    static constexpr uint16_t INIT = 0xFFFF;   //
+    static constexpr uint16_t POLY = StarDustCRCTables::POLY;
+
+    // Tek byte ile CRC güncelleme (parser içinde byte byte kullanım için)
+    // Update the CRC with a single byte (for byte-wise use inside the parser)
+    static inline uint16_t update(uint16_t crc, uint8_t data) {
+#if STARDUST_CRC_MODE == STARDUST_CRC_BITWISE
+        crc ^= static_cast<uint16_t>(data) << 8;
+        for (uint8_t j = 0; j < 8; ++j) {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ POLY) : static_cast<uint16_t>(crc << 1);
+        }
+        return crc;
+#elif STARDUST_CRC_MODE == STARDUST_CRC_NIBBLE
+        crc = static_cast<uint16_t>((crc << 4) ^ STARDUST_CRC_READ(StarDustCRCTables::Nibble::data, (crc >> 12) ^ (data >> 4)));
+        crc = static_cast<uint16_t>((crc << 4) ^ STARDUST_CRC_READ(StarDustCRCTables::Nibble::data, (crc >> 12) ^ (data & 0x0F)));
+        return crc;
+#else
+        return static_cast<uint16_t>((crc << 8) ^ STARDUST_CRC_READ(StarDustCRCTables::Slice<0>::data, (crc >> 8) ^ data));
+#endif
+    }
+
+    // Tampon ile CRC güncelleme (artımlı kullanım: önceki sonucu crc olarak verin).
+    // Dilim tabloları da AVR'de PROGMEM'dedir, her okuma STARDUST_CRC_READ'den geçer.
+    // Update the CRC with a buffer (incremental use: pass the previous result as crc).
+    // The slice tables are in PROGMEM on AVR as well, every lookup goes through STARDUST_CRC_READ.
+    static inline uint16_t update(uint16_t crc, const uint8_t* data, size_t length) {
+#if STARDUST_CRC_MODE == STARDUST_CRC_SLICE4 || STARDUST_CRC_MODE == STARDUST_CRC_SLICE8
+    #if STARDUST_CRC_MODE == STARDUST_CRC_SLICE8
+        while (length >= 8) {
+            crc = static_cast<uint16_t>(
+                slice<7>(data[0] ^ (crc >> 8)) ^ slice<6>(data[1] ^ (crc & 0xFF)) ^ slice<5>(data[2]) ^ slice<4>(data[3]) ^
+                slice<3>(data[4]) ^ slice<2>(data[5]) ^ slice<1>(data[6]) ^ slice<0>(data[7]));
+            data += 8;
+            length -= 8;
+        }
+    #endif
+        while (length >= 4) {
+            crc = static_cast<uint16_t>(
+                slice<3>(data[0] ^ (crc >> 8)) ^ slice<2>(data[1] ^ (crc & 0xFF)) ^ slice<1>(data[2]) ^ slice<0>(data[3]));
+            data += 4;
+            length -= 4;
+        }
+#endif
+        while (length--) {
+            crc = update(crc, *data++);
+        }
+        return crc;
+    }
+
+    // Tek seferlik hesaplama
+    // One-shot calculation
+    static inline uint16_t compute(const uint8_t* data, size_t length) {
+        return update(INIT, data, length);
+    }
+
+private:
+    template<size_t S>
+    static inline uint16_t slice(uint8_t index) {
+        return STARDUST_CRC_READ(StarDustCRCTables::Slice<S>::data, index);
+    }
+};
+
+// Nesne bütünlüğü için CRC32; tablo boyutu STARDUST_CRC_MODE'u izler (nibble: 64 byte, diğerleri: 1 KB)
+// CRC32 for object integrity; the table size follows STARDUST_CRC_MODE (nibble: 64 bytes, others: 1 KB)
+class StarDustCRC32 {
+public:
+    static constexpr uint32_t INIT = 0xFFFFFFFF;
+
+    static inline uint32_t update(uint32_t crc, uint8_t data) {
+#if STARDUST_CRC_MODE == STARDUST_CRC_BITWISE
+        crc ^= data;
+        for (uint8_t j = 0; j < 8; ++j) {
+            crc = (crc & 1) ? (crc >> 1) ^ StarDustCRCTables::POLY32 : crc >> 1;
+        }
+        return crc;
+#elif STARDUST_CRC_MODE == STARDUST_CRC_NIBBLE
+        crc = (crc >> 4) ^ STARDUST_CRC_READ32(StarDustCRCTables::Nibble32::data, (crc ^ data) & 0x0F);
+        crc = (crc >> 4) ^ STARDUST_CRC_READ32(StarDustCRCTables::Nibble32::data, (crc ^ (data >> 4)) & 0x0F);
+        return crc;
+#else
+        return (crc >> 8) ^ STARDUST_CRC_READ32(StarDustCRCTables::Byte32::data, (crc ^ data) & 0xFF);
+#endif
+    }
+
+    // Artımlı kullanım: önceki sonucu crc olarak verin, bitince finish() uygulayın
+    // Incremental use: pass the previous result as crc, apply finish() at the end
+    static inline uint32_t update(uint32_t crc, const uint8_t* data, size_t length) {
+        while (length--) {
+            crc = update(crc, *data++);
+        }
+        return crc;
+    }
+
+    static inline uint32_t finish(uint32_t crc) {
+        return ~crc;
+    }
+
+    static inline uint32_t compute(const uint8_t* data, size_t length) {
+        return finish(update(INIT, data, length));
+    }
+};
+
+#endif
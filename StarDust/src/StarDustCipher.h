@@ -0,0 +1,202 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Payload Cipher
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Payload cipher of the StarDust protocol: every byte is XORed with the 16-byte key and
+rotated left by 3 bits. Since rotl3(p ^ k) == rotl3(p) ^ rotl3(k), the key schedule stores
+the rotated key twice in a row; any 16-byte block starting at any payload offset then uses
+one contiguous key window, so the kernel can work a whole word or vector at a time.
+The kernel is selected with STARDUST_CIPHER_MODE, output is identical in every mode.
+STARDUST_CIPHER_NONE leaves payloads in plain text and compiles the cipher away; both
+ends of a line must then use it.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_CIPHER_H
+#define STARDUST_CIPHER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* ŞİFRE ÇEKİRDEĞİ SEÇENEKLERİ */
+/* CIPHER KERNEL OPTIONS */
+#define STARDUST_CIPHER_BYTEWISE 0 // Byte byte (8-bit çekirdekler)     // Byte by byte (8-bit cores)
+#define STARDUST_CIPHER_SWAR32   1 // 32-bit kelime içinde 4 byte        // 4 bytes inside a 32-bit word
+#define STARDUST_CIPHER_SWAR64   2 // 64-bit kelime içinde 8 byte        // 8 bytes inside a 64-bit word
+#define STARDUST_CIPHER_SSE2     3 // x86 SSE2, 16 byte/komut            // x86 SSE2, 16 bytes/instruction
+#define STARDUST_CIPHER_NEON     4 // ARM NEON, 16 byte/komut            // ARM NEON, 16 bytes/instruction
+#define STARDUST_CIPHER_NONE     5 // Şifre yok, anahtar çizelgesi boş    // No cipher, empty key schedule
+
+#ifndef STARDUST_CIPHER_MODE
+    #if defined(__AVR__)
+        #define STARDUST_CIPHER_MODE STARDUST_CIPHER_BYTEWISE
+    #elif defined(__SSE2__)
+        #define STARDUST_CIPHER_MODE STARDUST_CIPHER_SSE2
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define STARDUST_CIPHER_MODE STARDUST_CIPHER_NEON
+    #elif defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 8
+        #define STARDUST_CIPHER_MODE STARDUST_CIPHER_SWAR64
+    #else
+        #define STARDUST_CIPHER_MODE STARDUST_CIPHER_SWAR32  // ESP32 (S3 dahil), STM32, RP2040...
+    #endif
+#endif
+
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_SSE2
+    #include <emmintrin.h>
+#elif STARDUST_CIPHER_MODE == STARDUST_CIPHER_NEON
+    #include <arm_neon.h>
+#endif
+
+class StarDustCipher {
+public:
+    static constexpr uint8_t KEY_SIZE = 16;
+
+    // Anahtar çizelgesi: rotl3(anahtar) art arda iki kez, setCryptoKey() içinde bir kez hesaplanır
+    // Key schedule: rotl3(key) twice in a row, computed once in setCryptoKey()
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_NONE
+    // Düz metin: çizelge yer tutmaz, çağrılar derleyicide kaybolur
+    // Plain text: the schedule holds nothing, the calls vanish in the compiler
+    struct Schedule {};
+
+    static inline void expand(Schedule&, const uint8_t*) {}
+    static inline void encrypt(const Schedule&, uint8_t*, size_t, uint8_t = 0) {}
+    static inline void decrypt(const Schedule&, uint8_t*, size_t, uint8_t = 0) {}
+#else
+    struct Schedule {
+        uint8_t stream[2 * KEY_SIZE];
+    };
+
+    static inline void expand(Schedule& schedule, const uint8_t* key) {
+        for (uint8_t i = 0; i < KEY_SIZE; i++) {
+            schedule.stream[i] = schedule.stream[i + KEY_SIZE] = rotl3(key[i]);
+        }
+    }
+
+    // offset: verinin payload içindeki konumu, anahtar indeksi buna göre seçilir
+    // offset: position of the data inside the payload, the key index is chosen from it
+    static inline void encrypt(const Schedule& schedule, uint8_t* data, size_t length, uint8_t offset = 0) {
+        const uint8_t* key = &schedule.stream[offset % KEY_SIZE];
+        size_t i = 0;
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_SSE2
+        const __m128i k = _mm_loadu_si128((const __m128i*)key);
+        for (; i + 16 <= length; i += 16) {
+            const __m128i p = _mm_loadu_si128((const __m128i*)(data + i));
+            const __m128i r = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(p, 3), _mm_set1_epi8((char)0xF8)),
+                                           _mm_and_si128(_mm_srli_epi16(p, 5), _mm_set1_epi8(0x07)));
+            _mm_storeu_si128((__m128i*)(data + i), _mm_xor_si128(r, k));
+        }
+#elif STARDUST_CIPHER_MODE == STARDUST_CIPHER_NEON
+        const uint8x16_t k = vld1q_u8(key);
+        for (; i + 16 <= length; i += 16) {
+            const uint8x16_t p = vld1q_u8(data + i);
+            vst1q_u8(data + i, veorq_u8(vsliq_n_u8(vshrq_n_u8(p, 5), p, 3), k));
+        }
+#endif
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_SWAR64 || STARDUST_CIPHER_MODE == STARDUST_CIPHER_SSE2 || STARDUST_CIPHER_MODE == STARDUST_CIPHER_NEON
+        i = encryptWords<uint64_t>(key, data, length, i);
+#elif STARDUST_CIPHER_MODE == STARDUST_CIPHER_SWAR32
+        i = encryptWords<uint32_t>(key, data, length, i);
+#endif
+        for (; i < length; i++) {
+            data[i] = rotl3(data[i]) ^ key[i % KEY_SIZE];
+        }
+    }
+
+    static inline void decrypt(const Schedule& schedule, uint8_t* data, size_t length, uint8_t offset = 0) {
+        const uint8_t* key = &schedule.stream[offset % KEY_SIZE];
+        size_t i = 0;
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_SSE2
+        const __m128i k = _mm_loadu_si128((const __m128i*)key);
+        for (; i + 16 <= length; i += 16) {
+            const __m128i c = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), k);
+            const __m128i r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(c, 3), _mm_set1_epi8(0x1F)),
+                                           _mm_and_si128(_mm_slli_epi16(c, 5), _mm_set1_epi8((char)0xE0)));
+            _mm_storeu_si128((__m128i*)(data + i), r);
+        }
+#elif STARDUST_CIPHER_MODE == STARDUST_CIPHER_NEON
+        const uint8x16_t k = vld1q_u8(key);
+        for (; i + 16 <= length; i += 16) {
+            const uint8x16_t c = veorq_u8(vld1q_u8(data + i), k);
+            vst1q_u8(data + i, vsliq_n_u8(vshrq_n_u8(c, 3), c, 5));
+        }
+#endif
+#if STARDUST_CIPHER_MODE == STARDUST_CIPHER_SWAR64 || STARDUST_CIPHER_MODE == STARDUST_CIPHER_SSE2 || STARDUST_CIPHER_MODE == STARDUST_CIPHER_NEON
+        i = decryptWords<uint64_t>(key, data, length, i);
+#elif STARDUST_CIPHER_MODE == STARDUST_CIPHER_SWAR32
+        i = decryptWords<uint32_t>(key, data, length, i);
+#endif
+        for (; i < length; i++) {
+            data[i] = rotr3(data[i] ^ key[i % KEY_SIZE]);
+        }
+    }
+#endif
+
+private:
+    static inline uint8_t rotl3(uint8_t x) { return (uint8_t)((x << 3) | (x >> 5)); }
+    static inline uint8_t rotr3(uint8_t x) { return (uint8_t)((x >> 3) | (x << 5)); }
+
+    // Kelime içindeki her byte ayrı döndürülür: komşu byte'a taşan bitler maskeyle silinir
+    // Every byte inside the word is rotated on its own: bits spilling into the neighbour byte are masked off
+    template<typename W> static inline W lanes(uint8_t value) { return (W)((W)~(W)0 / 0xFF * value); }
+
+    // Kelimeler memcpy ile okunur: hizalama şartı yok, derleyici tek yükleme komutuna indirger
+    // Words are loaded with memcpy: no alignment requirement, the compiler reduces it to a single load
+    template<typename W>
+    static inline size_t encryptWords(const uint8_t* key, uint8_t* data, size_t length, size_t i) {
+        for (; i + sizeof(W) <= length; i += sizeof(W)) {
+            W p, k;
+            memcpy(&p, data + i, sizeof(W));
+            memcpy(&k, key + (i % KEY_SIZE), sizeof(W));
+            p = (W)((((W)(p << 3)) & lanes<W>(0xF8)) | ((p >> 5) & lanes<W>(0x07))) ^ k;
+            memcpy(data + i, &p, sizeof(W));
+        }
+        return i;
+    }
+
+    template<typename W>
+    static inline size_t decryptWords(const uint8_t* key, uint8_t* data, size_t length, size_t i) {
+        for (; i + sizeof(W) <= length; i += sizeof(W)) {
+            W c, k;
+            memcpy(&c, data + i, sizeof(W));
+            memcpy(&k, key + (i % KEY_SIZE), sizeof(W));
+            c ^= k;
+            c = (W)(((c >> 3) & lanes<W>(0x1F)) | (((W)(c << 5)) & lanes<W>(0xE0)));
+            memcpy(data + i, &c, sizeof(W));
+        }
+        return i;
+    }
+};
+
+#endif
@@ -0,0 +1,102 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Capture Log
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustLog.h"
+
+#if STARDUST_CAPTURE
+StarDustLogWriter::StarDustLogWriter() {
+    _out = nullptr;
+    _records = 0;
+    _dropped = 0;
+    memset(_taps, 0, sizeof(_taps));
+}
+
+bool StarDustLogWriter::begin(Stream& out) {
+    _out = &out;
+    StarDustLogHeader header;
+    memcpy(header.magic, STARDUST_LOG_MAGIC, sizeof(header.magic));
+    header.version = STARDUST_LOG_VERSION;
+    header.framing = STARDUST_FRAMING;
+    header.payloadSize = PAYLOADSIZE;
+    header.flags = STARDUST_VARIABLE_FRAMES ? STARDUST_LOG_VARIABLE_FRAMES : 0;
+    return out.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+}
+
+bool StarDustLogWriter::attach(StarDustCore& link, uint8_t linkID) {
+    Tap* tap = nullptr;
+    for (uint8_t i = 0; i < STARDUST_LOG_LINKS; i++) {
+        if (_taps[i].link == &link) tap = &_taps[i];
+    }
+    for (uint8_t i = 0; i < STARDUST_LOG_LINKS && tap == nullptr; i++) {
+        if (_taps[i].link == nullptr) tap = &_taps[i];
+    }
+    if (tap == nullptr) return false; // Tablo dolu // Table full
+    tap->writer = this;
+    tap->link = &link;
+    tap->id = linkID;
+    link.onCapture(&StarDustLogWriter::onFrame, tap);
+    return true;
+}
+
+void StarDustLogWriter::detach(StarDustCore& link) {
+    for (uint8_t i = 0; i < STARDUST_LOG_LINKS; i++) {
+        if (_taps[i].link == &link) {
+            link.onCapture(nullptr);
+            memset(&_taps[i], 0, sizeof(_taps[i]));
+        }
+    }
+}
+
+void StarDustLogWriter::record(uint8_t linkID, const uint8_t* frame, uint8_t length, CaptureResult result) {
+    if (_out == nullptr || length > MAX_FRAME_SIZE) return;
+    // Kayıt tek parça yazılır: yarım kalan kayıt yalnızca güç kesilirse oluşur
+    // The record is written in one piece: a partial record only happens on a power loss
+    uint8_t buffer[sizeof(StarDustLogRecord) + MAX_FRAME_SIZE];
+    StarDustLogRecord* record = (StarDustLogRecord*)buffer;
+    record->sync = STARDUST_LOG_SYNC;
+    record->length = length;
+    record->link = linkID;
+    record->result = (uint8_t)result;
+    record->time = STARDUST_LOG_CLOCK();
+    memcpy(buffer + sizeof(StarDustLogRecord), frame, length);
+
+    const size_t size = sizeof(StarDustLogRecord) + length;
+    if (_out->write(buffer, size) == size) {
+        _records++;
+    } else {
+        _dropped++;
+    }
+}
+
+void StarDustLogWriter::onFrame(const uint8_t* frame, uint8_t length, CaptureResult result, void* context) {
+    Tap* tap = static_cast<Tap*>(context);
+    tap->writer->record(tap->id, frame, length, result);
+}
+#endif
@@ -0,0 +1,120 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Capture Log
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Append-only binary log of the raw frames seen by one or more StarDust links. The file
+starts with a StarDustLogHeader, followed by records: a StarDustLogRecord (sync byte,
+frame length, link ID, CaptureResult, timestamp) and the frame bytes exactly as they
+were on the wire, encrypted and framed. Records are written whole with one write() so
+an SD card or a host file can be used as the Stream; a record cut short by a power loss
+is skipped by the reader, which looks for the next sync byte. All fields little-endian.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_LOG_H
+#define STARDUST_LOG_H
+
+#include "StarDust.h"
+
+// Kayıt zaman damgası için saat (varsayılan mikrosaniye, 32 bit döner; okuyucu dönüşleri açar)
+// Clock for the record timestamp (microseconds by default, wraps at 32 bits; the reader unwraps it)
+#ifndef STARDUST_LOG_CLOCK
+    #define STARDUST_LOG_CLOCK() micros()
+#endif
+
+// Tek yazıcıya bağlanabilecek bağlantı sayısı // Number of links that can be attached to one writer
+#ifndef STARDUST_LOG_LINKS
+    #if defined(__AVR__)
+        #define STARDUST_LOG_LINKS 1
+    #else
+        #define STARDUST_LOG_LINKS 8
+    #endif
+#endif
+
+constexpr uint8_t STARDUST_LOG_MAGIC[4] = { 'S', 'D', 'L', 'G' };
+constexpr uint8_t STARDUST_LOG_VERSION = 1;
+constexpr uint8_t STARDUST_LOG_SYNC = 0xA5;       // Her kaydın ilk byte'ı // First byte of every record
+constexpr uint8_t STARDUST_LOG_VARIABLE_FRAMES = 0x01; // flags
+
+struct __attribute__((packed)) StarDustLogHeader {
+    uint8_t magic[4];
+    uint8_t version;
+    uint8_t framing;      // STARDUST_FRAMING_START_BYTE / STARDUST_FRAMING_COBS
+    uint8_t payloadSize;  // PAYLOADSIZE
+    uint8_t flags;
+};
+
+struct __attribute__((packed)) StarDustLogRecord {
+    uint8_t sync;
+    uint8_t length;       // Ardından gelen çerçeve byte'ları // Frame bytes that follow
+    uint8_t link;
+    uint8_t result;       // CaptureResult
+    uint32_t time;        // STARDUST_LOG_CLOCK
+};
+
+#if STARDUST_CAPTURE
+class StarDustLogWriter {
+public:
+    StarDustLogWriter();
+
+    // Dosya başlığını yazar; kayıtlar bu Stream'e eklenir // Writes the file header; records are appended to this Stream
+    bool begin(Stream& out);
+    // Bağlantının onCapture() kancasını kullanır; linkID kayıtlarda bağlantıyı ayırt eder
+    // Uses the onCapture() hook of the link; linkID tells the links apart in the records
+    bool attach(StarDustCore& link, uint8_t linkID);
+    void detach(StarDustCore& link);
+
+    // Kendi kaynağınızdan çerçeve eklemek için (ör. gönderilen çerçeveler) // To add frames from your own source (e.g. sent frames)
+    void record(uint8_t linkID, const uint8_t* frame, uint8_t length, CaptureResult result);
+
+    uint32_t records() const { return _records; }
+    uint32_t dropped() const { return _dropped; } // Stream'in tamamını kabul etmediği kayıtlar // Records the Stream did not take in full
+
+private:
+    struct Tap {
+        StarDustLogWriter* writer;
+        StarDustCore* link;
+        uint8_t id;
+    };
+
+    Stream* _out;
+    uint32_t _records;
+    uint32_t _dropped;
+    Tap _taps[STARDUST_LOG_LINKS];
+
+    static void onFrame(const uint8_t* frame, uint8_t length, CaptureResult result, void* context);
+};
+#endif
+
+#endif
@@ -0,0 +1,435 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Reliable Delivery
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustReliable.h"
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+static constexpr uint8_t WINDOW_MASK = STARDUST_RELIABLE_WINDOW - 1;
+static constexpr uint32_t INITIAL_RTO = 1000; // İlk ölçümden önce (ms) // Before the first measurement (ms)
+static constexpr uint32_t MAX_RTO = 10000;
+
+StarDustReliable::StarDustReliable() {
+    _link = nullptr;
+    _receiver = nullptr;
+    _receiverContext = nullptr;
+    _minRto = 20;
+    _maxRetries = 8;
+    memset(&_stats, 0, sizeof(_stats));
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS; i++) {
+        clearPeer(_peers[i], 0);
+    }
+}
+
+void StarDustReliable::begin(StarDustCore& link) {
+    _link = &link;
+    link.onPacket<RELIABLE>(&StarDustReliable::onData, this);
+    link.onPacket<RELIABLEACK>(&StarDustReliable::onControl, this);
+}
+
+void StarDustReliable::onReceive(ReceiveHandler handler, void* context) {
+    _receiver = handler;
+    _receiverContext = context;
+}
+
+void StarDustReliable::setRetransmitTimeout(uint16_t minMs) {
+    _minRto = minMs;
+}
+
+void StarDustReliable::setMaxRetries(uint8_t retries) {
+    _maxRetries = retries;
+}
+
+const StarDustReliable::Stats& StarDustReliable::stats() const {
+    return _stats;
+}
+
+// ======================== EŞ TABLOSU ========================
+// ======================== PEER TABLE ========================
+void StarDustReliable::clearPeer(Peer& peer, uint8_t id) {
+    memset(&peer, 0, sizeof(peer));
+    peer.id = id;
+    peer.rto = INITIAL_RTO;
+}
+
+StarDustReliable::Peer* StarDustReliable::findPeer(uint8_t id) {
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS; i++) {
+        if (_peers[i].used && _peers[i].id == id) return &_peers[i];
+    }
+    return nullptr;
+}
+
+const StarDustReliable::Peer* StarDustReliable::findPeer(uint8_t id) const {
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS; i++) {
+        if (_peers[i].used && _peers[i].id == id) return &_peers[i];
+    }
+    return nullptr;
+}
+
+StarDustReliable::Peer* StarDustReliable::allocPeer(uint8_t id) {
+    Peer* peer = findPeer(id);
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS && peer == nullptr; i++) {
+        if (!_peers[i].used) {
+            peer = &_peers[i];
+            clearPeer(*peer, id);
+            peer->used = true;
+        }
+    }
+    return peer; // Tablo doluysa nullptr // nullptr when the table is full
+}
+
+void StarDustReliable::resetPeer(uint8_t id) {
+    Peer* peer = findPeer(id);
+    if (peer != nullptr) clearPeer(*peer, 0);
+}
+
+uint8_t StarDustReliable::inFlight(uint8_t id) const {
+    const Peer* peer = findPeer(id);
+    return (peer != nullptr) ? (uint8_t)(peer->txNext - peer->txBase) : 0;
+}
+
+uint8_t StarDustReliable::failures(uint8_t id) const {
+    const Peer* peer = findPeer(id);
+    return (peer != nullptr) ? peer->failures : 0;
+}
+
+bool StarDustReliable::idle() const {
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS; i++) {
+        if (_peers[i].used && _peers[i].txNext != _peers[i].txBase) return false;
+    }
+    return true;
+}
+
+// ======================== GÖNDEREN ========================
+// ======================== SENDER ==========================
+bool StarDustReliable::send(uint8_t target, PacketType type, const void* data, uint8_t size) {
+    if (_link == nullptr || size > MAX_DATA || target == BROADCAST_ID) return false;
+    Peer* peer = allocPeer(target);
+    if (peer == nullptr) return false;
+    if ((uint8_t)(peer->txNext - peer->txBase) >= STARDUST_RELIABLE_WINDOW) return false; // Pencere dolu // Window full
+
+    // Mesaj, hattaki haliyle (sıra numarası + tip + veri) pencere yuvasına kopyalanır
+    // The message is copied into its window slot as it goes on the wire (sequence number + type + data)
+    TxSlot& slot = peer->tx[peer->txNext & WINDOW_MASK];
+    slot.frame[0] = peer->txNext;
+    slot.frame[1] = type;
+    memcpy(&slot.frame[2], data, size);
+    slot.size = size + 2;
+    slot.state = PENDING;
+    slot.retries = 0;
+    peer->txNext++;
+    _stats.sent++;
+
+    const uint32_t now = millis();
+    if (peer->txSynced) {
+        transmit(*peer, slot, now);
+    } else if (peer->syncRetries == 0) {
+        peer->syncDue = true; // Oturum yok: önce SYNC // No session: SYNC first
+        serviceSender(*peer, now);
+    }
+    return true;
+}
+
+bool StarDustReliable::transmit(Peer& peer, TxSlot& slot, uint32_t now) {
+    // Gönderim kuyruğu doluysa yuva olduğu gibi kalır, bir sonraki update() yeniden dener
+    // If the transmit queue is full the slot stays as it is, the next update() tries again
+    if (!_link->sendPayload(peer.id, RELIABLE, slot.frame, slot.size)) return false;
+    if (!outstanding(peer)) peer.timerStart = now; // Boş hatta zamanlayıcı başlar // The timer starts on an idle line
+    slot.state = SENT;
+    slot.sentTime = now;
+    slot.order = ++peer.txOrder;
+    return true;
+}
+
+bool StarDustReliable::outstanding(const Peer& peer) const {
+    for (uint8_t seq = peer.txBase; seq != peer.txNext; seq++) {
+        if (peer.tx[seq & WINDOW_MASK].state == SENT) return true;
+    }
+    return false;
+}
+
+void StarDustReliable::sendControl(uint8_t target, uint8_t kind, uint8_t seq, uint32_t sack) {
+    const ReliableControlPayload control = {kind, seq, sack};
+    _link->sendPayload(target, RELIABLEACK, &control, sizeof(control));
+}
+
+void StarDustReliable::serviceSender(Peer& peer, uint32_t now) {
+    if (peer.txNext == peer.txBase) return; // Bekleyen mesaj yok // Nothing outstanding
+
+    if (!peer.txSynced) {
+        if (!peer.syncDue && now - peer.syncTime < peer.rto) return;
+        if (peer.syncRetries >= _maxRetries) {
+            failWindow(peer);
+            return;
+        }
+        sendControl(peer.id, SYNC, peer.txBase, 0);
+        peer.syncTime = now;
+        peer.syncDue = false;
+        peer.syncRetries++;
+        _stats.syncs++;
+        return;
+    }
+
+    TxSlot* oldest = nullptr;
+    for (uint8_t seq = peer.txBase; seq != peer.txNext; seq++) {
+        TxSlot& slot = peer.tx[seq & WINDOW_MASK];
+        if (slot.state == PENDING) {
+            if (!transmit(peer, slot, now)) break;
+        } else if (slot.state == SENT && oldest == nullptr) {
+            oldest = &slot;
+        }
+    }
+
+    // Tek zamanlayıcı (RFC 6298): ilerleme oldukça yeniden kurulur. Hat seri olduğundan çerçeve başına süre,
+    // önündeki kuyruğu da ölçer ve yanlış alarmlara yol açar. Süre dolunca yalnızca en eski çerçeve gider,
+    // diğer kayıpları onun onayı ortaya çıkarır.
+    // Single timer (RFC 6298): restarted whenever there is progress. On a serial line a per-frame timer would
+    // also measure the queue in front of the frame and fire falsely. On expiry only the oldest frame is resent,
+    // its ack exposes the other losses.
+    if (oldest != nullptr && now - peer.timerStart >= peer.rto) {
+        if (oldest->retries >= _maxRetries) {
+            failWindow(peer);
+            return;
+        }
+        if (!transmit(peer, *oldest, now)) return;
+        oldest->retries++;
+        _stats.retransmits++;
+        peer.timerStart = now;
+        peer.rto = (peer.rto * 2 < MAX_RTO) ? peer.rto * 2 : MAX_RTO;
+    }
+}
+
+void StarDustReliable::failWindow(Peer& peer) {
+    // Alıcı kayıp mesajı hiçbir zaman alamayacak: pencere atılır, sonraki mesaj yeni bir oturumla (SYNC) başlar
+    // The receiver will never get the lost message: the window is dropped, the next message starts a new session (SYNC)
+    for (uint8_t seq = peer.txBase; seq != peer.txNext; seq++) {
+        peer.tx[seq & WINDOW_MASK].state = FREE;
+        _stats.failed++;
+    }
+    peer.txBase = peer.txNext;
+    peer.failures++;
+    peer.txSynced = false;
+    peer.syncDue = false;
+    peer.syncRetries = 0;
+}
+
+void StarDustReliable::requeue(Peer& peer) {
+    // Alıcı tamponunu kaybetti: seçici onaylananlar dahil her şey yeniden gönderilir
+    // The receiver lost its buffer: everything, selectively acked ones included, is sent again
+    for (uint8_t seq = peer.txBase; seq != peer.txNext; seq++) {
+        TxSlot& slot = peer.tx[seq & WINDOW_MASK];
+        slot.state = PENDING;
+        slot.retries = 0;
+    }
+    peer.txSynced = false;
+    peer.syncDue = true;
+    peer.syncRetries = 0;
+}
+
+void StarDustReliable::sampleRtt(Peer& peer, const TxSlot& slot, uint32_t now) {
+    // Karn kuralı: yeniden gönderilmiş mesajın süresi belirsizdir, ölçülmez
+    // Karn's rule: the time of a resent message is ambiguous, it is not measured
+    if (slot.retries > 0) return;
+    const uint32_t sample = now - slot.sentTime;
+    if (!peer.rttValid) {
+        peer.srtt = sample;
+        peer.rttvar = sample / 2;
+        peer.rttValid = true;
+    } else {
+        const uint32_t delta = (peer.srtt > sample) ? peer.srtt - sample : sample - peer.srtt;
+        peer.rttvar = (3 * peer.rttvar + delta) / 4;
+        peer.srtt = (7 * peer.srtt + sample) / 8;
+    }
+    uint32_t rto = peer.srtt + 4 * peer.rttvar;
+    if (rto < _minRto) rto = _minRto;
+    if (rto > MAX_RTO) rto = MAX_RTO;
+    peer.rto = rto;
+}
+
+void StarDustReliable::handleAck(Peer& peer, uint8_t cumulative, uint32_t sack, uint32_t now) {
+    if (!peer.txSynced) return;
+    const uint8_t outstanding = peer.txNext - peer.txBase;
+    if ((uint8_t)(cumulative - peer.txBase) > outstanding) {
+        // Alıcının durumu bizimkiyle uyuşmuyor (yeniden başlamış olabilir): oturum yenilenir
+        // The receiver's state does not match ours (it may have restarted): the session is renewed
+        requeue(peer);
+        return;
+    }
+
+    // Kümülatif onay: cumulative'den öncekiler teslim edildi
+    // Cumulative ack: everything before cumulative was delivered
+    if (peer.txBase != cumulative) peer.timerStart = now;
+    for (; peer.txBase != cumulative; peer.txBase++) {
+        TxSlot& slot = peer.tx[peer.txBase & WINDOW_MASK];
+        if (slot.state == SENT) {
+            sampleRtt(peer, slot, now);
+            if ((int16_t)(slot.order - peer.ackedOrder) > 0) peer.ackedOrder = slot.order;
+        }
+        slot.state = FREE;
+    }
+
+    // Seçici onay: bit i, cumulative + i alıcıda tamponda
+    // Selective ack: bit i, cumulative + i is buffered at the receiver
+    const uint8_t remaining = peer.txNext - peer.txBase;
+    for (uint8_t i = 1; i < remaining; i++) {
+        TxSlot& slot = peer.tx[(uint8_t)(peer.txBase + i) & WINDOW_MASK];
+        if (((sack >> i) & 1) && slot.state == SENT) {
+            peer.timerStart = now;
+            sampleRtt(peer, slot, now);
+            if ((int16_t)(slot.order - peer.ackedOrder) > 0) peer.ackedOrder = slot.order;
+            slot.state = ACKED;
+        }
+    }
+
+    // Hat sırayı korur: kendisinden sonra gönderilen bir çerçeve onaylanmışsa bu çerçeve kaybolmuştur
+    // The line keeps order: if a frame sent after this one was acked, this one was lost
+    for (uint8_t i = 0; i < remaining; i++) {
+        TxSlot& slot = peer.tx[(uint8_t)(peer.txBase + i) & WINDOW_MASK];
+        if (slot.state == SENT && (int16_t)(slot.order - peer.ackedOrder) < 0) {
+            if (slot.retries >= _maxRetries) {
+                failWindow(peer);
+                return;
+            }
+            if (!transmit(peer, slot, now)) break;
+            slot.retries++;
+            _stats.fastRetransmits++;
+        }
+    }
+}
+
+// ======================== ALICI ========================
+// ======================== RECEIVER ======================
+void StarDustReliable::deliver(Peer& peer, const uint8_t* frame, uint8_t size) {
+    _stats.delivered++;
+    if (_receiver != nullptr) {
+        _receiver(peer.id, (PacketType)frame[1], &frame[2], size - 2, _receiverContext);
+    }
+}
+
+void StarDustReliable::onData(const ReliableDataPayload& payload, const PacketHeader& header, void* context) {
+    StarDustReliable* self = (StarDustReliable*)context;
+    // Dinleyici (PROMISCUOUS) kipinde başkalarına giden çerçeveler onaylanmaz
+    // Frames for others (PROMISCUOUS listener mode) are not acknowledged
+    if (header.target != self->_link->getID() || header.size < 2) return;
+
+    Peer* peer = self->findPeer(header.source);
+    if (peer == nullptr || !peer->rxSynced) {
+        self->sendControl(header.source, RESYNC, 0, 0);
+        return;
+    }
+
+    peer->ackPending = true;
+    const uint8_t offset = payload.seq - peer->rxBase;
+    if (offset >= 0x80 || (offset < STARDUST_RELIABLE_WINDOW && ((peer->rxMask >> offset) & 1))) {
+        self->_stats.duplicates++; // Daha önce alındı, onay kaybolmuş olmalı // Received before, the ack must have been lost
+        return;
+    }
+    if (offset >= STARDUST_RELIABLE_WINDOW) return; // Pencerenin ötesinde // Beyond the window
+
+    const uint8_t* frame = (const uint8_t*)&payload;
+    if (offset == 0) {
+        // Sıradaki mesaj kuyruk yuvasından kopyalanmadan teslim edilir, ardından tamponda bekleyenler
+        // The next message is delivered straight from the queue slot without a copy, then the buffered ones
+        self->deliver(*peer, frame, header.size);
+        peer->rxBase++;
+        peer->rxMask >>= 1;
+        while (peer->rxMask & 1) {
+            const RxSlot& slot = peer->rx[peer->rxBase & WINDOW_MASK];
+            self->deliver(*peer, slot.frame, slot.size);
+            peer->rxBase++;
+            peer->rxMask >>= 1;
+        }
+    } else {
+        RxSlot& slot = peer->rx[payload.seq & WINDOW_MASK];
+        memcpy(slot.frame, frame, header.size);
+        slot.size = header.size;
+        peer->rxMask |= (uint32_t)1 << offset;
+    }
+}
+
+void StarDustReliable::onControl(const ReliableControlPayload& payload, const PacketHeader& header, void* context) {
+    StarDustReliable* self = (StarDustReliable*)context;
+    if (header.target != self->_link->getID()) return;
+
+    Peer* peer;
+    switch (payload.kind) {
+        case SYNC:
+            // Yeni oturum: alım durumu sıfırlanır // New session: the receive state is reset
+            peer = self->allocPeer(header.source);
+            if (peer == nullptr) return;
+            peer->rxSynced = true;
+            peer->rxBase = payload.seq;
+            peer->rxMask = 0;
+            peer->ackPending = false;
+            self->sendControl(header.source, SYNCACK, payload.seq, 0);
+            break;
+
+        case SYNCACK:
+            peer = self->findPeer(header.source);
+            if (peer != nullptr && !peer->txSynced && payload.seq == peer->txBase) {
+                peer->txSynced = true;
+                peer->syncRetries = 0;
+                self->serviceSender(*peer, millis());
+            }
+            break;
+
+        case RESYNC:
+            peer = self->findPeer(header.source);
+            if (peer != nullptr && peer->txSynced) self->requeue(*peer);
+            break;
+
+        case ACK:
+            peer = self->findPeer(header.source);
+            if (peer != nullptr) self->handleAck(*peer, payload.seq, payload.sack, millis());
+            break;
+    }
+}
+
+// ======================== DÖNGÜ ========================
+// ======================== LOOP ==========================
+uint8_t StarDustReliable::update() {
+    if (_link == nullptr) return 0;
+    const uint8_t handled = _link->dispatch();
+
+    // Bir update() içinde gelen tüm çerçeveler tek bir onayla karşılanır
+    // All frames received within one update() are answered with a single ack
+    const uint32_t now = millis();
+    for (uint8_t i = 0; i < STARDUST_RELIABLE_PEERS; i++) {
+        Peer& peer = _peers[i];
+        if (!peer.used) continue;
+        if (peer.ackPending) {
+            peer.ackPending = false;
+            sendControl(peer.id, ACK, peer.rxBase, peer.rxMask);
+            _stats.acksSent++;
+        }
+        serviceSender(peer, now);
+    }
+    return handled;
+}
+#endif
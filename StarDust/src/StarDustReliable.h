@@ -0,0 +1,198 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Reliable Delivery
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Selective-repeat reliable delivery on top of a StarDust link. Messages are numbered per
+peer, up to STARDUST_RELIABLE_WINDOW of them are in flight at once, the receiver answers
+with a cumulative ack plus a selective-ack bitmap and delivers in order without duplicates.
+Lost frames are sent again when a later frame is acknowledged or when the adaptive
+retransmission timer (driven by millis() inside update()) expires. All buffers are static.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_RELIABLE_H
+#define STARDUST_RELIABLE_H
+
+#include "StarDust.h"
+
+// Eş başına gönderim/alım penceresi (2'nin kuvveti, en çok 32: SACK bit haritası 32 bit)
+// Send/receive window per peer (power of two, at most 32: the SACK bitmap is 32 bits)
+#ifndef STARDUST_RELIABLE_WINDOW
+    #if defined(__AVR__)
+        #define STARDUST_RELIABLE_WINDOW 4
+    #else
+        #define STARDUST_RELIABLE_WINDOW 16
+    #endif
+#endif
+static_assert(STARDUST_RELIABLE_WINDOW >= 1 && STARDUST_RELIABLE_WINDOW <= 32 &&
+              (STARDUST_RELIABLE_WINDOW & (STARDUST_RELIABLE_WINDOW - 1)) == 0, "STARDUST_RELIABLE_WINDOW must be a power of two, 1..32");
+
+// Aynı anda oturum tutulan eş sayısı // Number of peers with a session at the same time
+#ifndef STARDUST_RELIABLE_PEERS
+    #if defined(__AVR__)
+        #define STARDUST_RELIABLE_PEERS 1
+    #else
+        #define STARDUST_RELIABLE_PEERS 4
+    #endif
+#endif
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+class StarDustReliable {
+public:
+    static constexpr uint8_t MAX_DATA = PAYLOADSIZE - 2; // Mesaj başına azami byte // Maximum bytes per message
+
+    // Kontrol çerçevesi türleri (RELIABLEACK) // Control frame kinds (RELIABLEACK)
+    enum ControlKind : uint8_t {
+        ACK = 0,     // Alıcı -> gönderen: seq'e kadar hepsi alındı, sack = sonrakiler // Receiver -> sender: all before seq received, sack = the ones after
+        SYNC = 1,    // Gönderen -> alıcı: sıradaki numaram seq // Sender -> receiver: my next number is seq
+        SYNCACK = 2, // Alıcı SYNC'i onaylar // Receiver confirms SYNC
+        RESYNC = 3   // Alıcı: seninle oturumum yok (ör. yeniden başladım) // Receiver: I have no session with you (e.g. I restarted)
+    };
+
+    typedef void (*ReceiveHandler)(uint8_t source, PacketType type, const uint8_t* data, uint8_t size, void* context);
+
+    struct Stats {
+        uint32_t sent;            // İlk kez gönderilen mesajlar // Messages sent for the first time
+        uint32_t retransmits;     // Zamanlayıcıyla yeniden gönderim // Resent by the timer
+        uint32_t fastRetransmits; // Sonraki çerçeve onaylanınca yeniden gönderim // Resent when a later frame was acked
+        uint32_t delivered;       // Uygulamaya sırayla verilen mesajlar // Messages delivered to the application in order
+        uint32_t duplicates;      // Bastırılan kopyalar // Suppressed duplicates
+        uint32_t failed;          // Onay alınamadan vazgeçilen mesajlar (alıcıya ulaşmış olabilir) // Messages given up without an ack (they may have arrived)
+        uint32_t acksSent;
+        uint32_t syncs;
+    };
+
+    StarDustReliable();
+
+    // Bağlantıya RELIABLE/RELIABLEACK işleyicilerini kaydeder; diğer tipler link.onPacket() ile işlenir
+    // Registers the RELIABLE/RELIABLEACK handlers on the link; other types are handled with link.onPacket()
+    void begin(StarDustCore& link);
+    void onReceive(ReceiveHandler handler, void* context = nullptr);
+
+    // Pencere doluysa false döner, mesaj kopyalanır ve onaylanana kadar saklanır
+    // Returns false when the window is full, the message is copied and kept until acknowledged
+    bool send(uint8_t target, PacketType type, const void* data, uint8_t size);
+    template<typename Payload>
+    bool send(uint8_t target, const Payload& payload) {
+        static_assert(sizeof(Payload) <= MAX_DATA, "Payload does not fit into a reliable frame");
+        return send(target, StarDustPayloadType<Payload>::type, &payload, sizeof(Payload));
+    }
+
+    // link.dispatch(), onaylar ve yeniden gönderimler; ana döngüden çağrılmalıdır
+    // link.dispatch(), acks and retransmissions; call it from the main loop
+    uint8_t update();
+
+    void setRetransmitTimeout(uint16_t minMs);  // Uyarlanabilir zamanlayıcının alt sınırı // Lower bound of the adaptive timer
+    void setMaxRetries(uint8_t retries);
+    uint8_t inFlight(uint8_t peer) const;       // Onay bekleyen mesajlar // Messages waiting for an ack
+    bool idle() const;                          // Hiçbir eşe onay beklenmiyor // Nothing waits for an ack from any peer
+    void resetPeer(uint8_t peer);
+    uint8_t failures(uint8_t peer) const;       // Bu eşe atılan pencere sayısı (döner) // Windows dropped for this peer (wraps)
+    const Stats& stats() const;
+
+private:
+    enum SlotState : uint8_t { FREE, PENDING, SENT, ACKED };
+
+    struct TxSlot {
+        uint32_t sentTime;
+        uint16_t order;       // Gönderim sırası: daha sonra gönderilen onaylandıysa bu kayıptır // Send order: if a later one was acked, this one is lost
+        uint8_t state;
+        uint8_t retries;
+        uint8_t size;         // Alt başlık dahil // Including the sub-header
+        uint8_t frame[PAYLOADSIZE];
+    };
+
+    struct RxSlot {
+        uint8_t size;
+        uint8_t frame[PAYLOADSIZE];
+    };
+
+    struct Peer {
+        uint8_t id;
+        bool used;
+
+        // Gönderen tarafı // Sender side
+        bool txSynced;
+        bool syncDue;
+        uint8_t txBase;       // Onay bekleyen en eski numara // Oldest number waiting for an ack
+        uint8_t txNext;
+        uint8_t syncRetries;
+        uint8_t failures;
+        uint16_t txOrder;
+        uint16_t ackedOrder;  // Onaylanan en geç gönderim // Latest acknowledged transmission
+        uint32_t syncTime;
+        uint32_t timerStart;  // Yeniden gönderim zamanlayıcısı // Retransmission timer
+        bool rttValid;
+        uint32_t srtt;        // Düzgünleştirilmiş gidiş-dönüş (ms) // Smoothed round trip (ms)
+        uint32_t rttvar;
+        uint32_t rto;
+        TxSlot tx[STARDUST_RELIABLE_WINDOW];
+
+        // Alıcı tarafı // Receiver side
+        bool rxSynced;
+        bool ackPending;
+        uint8_t rxBase;       // Beklenen sıradaki numara // Next expected number
+        uint32_t rxMask;      // bit i: rxBase + i tamponda // bit i: rxBase + i is buffered
+        RxSlot rx[STARDUST_RELIABLE_WINDOW];
+    };
+
+    StarDustCore* _link;
+    ReceiveHandler _receiver;
+    void* _receiverContext;
+    uint16_t _minRto;
+    uint8_t _maxRetries;
+    Stats _stats;
+    Peer _peers[STARDUST_RELIABLE_PEERS];
+
+    Peer* findPeer(uint8_t id);
+    const Peer* findPeer(uint8_t id) const;
+    Peer* allocPeer(uint8_t id);
+    void clearPeer(Peer& peer, uint8_t id);
+    bool transmit(Peer& peer, TxSlot& slot, uint32_t now);
+    bool outstanding(const Peer& peer) const;
+    void sendControl(uint8_t target, uint8_t kind, uint8_t seq, uint32_t sack);
+    void serviceSender(Peer& peer, uint32_t now);
+    void failWindow(Peer& peer);
+    void requeue(Peer& peer);
+    void sampleRtt(Peer& peer, const TxSlot& slot, uint32_t now);
+    void handleAck(Peer& peer, uint8_t cumulative, uint32_t sack, uint32_t now);
+    void deliver(Peer& peer, const uint8_t* frame, uint8_t size);
+
+    static void onData(const ReliableDataPayload& payload, const PacketHeader& header, void* context);
+    static void onControl(const ReliableControlPayload& payload, const PacketHeader& header, void* context);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Lock-Free Rings
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Lock-free rings used by StarDust. StarDustByteRing is single-producer / single-consumer
+and backs StarDust::feed(): the producer may be a UART RX interrupt or a DMA idle-line
+callback, the consumer is the task that calls StarDust::update(). StarDustSlotRing is
+multi-producer / single-consumer and holds whole frames for the transmit queue, so
+several RTOS tasks can send on one StarDust instance without a mutex.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_RING_H
+#define STARDUST_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__AVR__)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+#endif
+
+// İndeksler serbest döner; AVR'de tek byte'lık erişim kesmelere karşı atomiktir
+// Indices run freely; on AVR a single byte access is atomic against interrupts
+#if defined(__AVR__)
+    typedef uint8_t StarDustRingIndex;
+    typedef int8_t StarDustRingDiff;
+#else
+    typedef uint32_t StarDustRingIndex;
+    typedef int32_t StarDustRingDiff;
+#endif
+
+// Karşılaştır-ve-değiştir: CAS komutu olmayan çekirdeklerde (AVR, Cortex-M0) kısa bir kesme kilidiyle
+// Compare-and-swap: with a short interrupt lock on cores without a CAS instruction (AVR, Cortex-M0)
+template<typename T>
+static inline bool stardustCompareExchange(T* target, T& expected, T desired) {
+#if defined(__AVR__)
+    const uint8_t sreg = SREG;
+    cli();
+    const bool swapped = (*target == expected);
+    if (swapped) *target = desired; else expected = *target;
+    SREG = sreg;
+    return swapped;
+#elif defined(__ARM_ARCH_6M__)
+    uint32_t primask;
+    __asm__ volatile ("mrs %0, primask\n cpsid i" : "=r" (primask) :: "memory");
+    const bool swapped = (*target == expected);
+    if (swapped) *target = desired; else expected = *target;
+    __asm__ volatile ("msr primask, %0" :: "r" (primask) : "memory");
+    return swapped;
+#else
+    return __atomic_compare_exchange_n(target, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Çok byte'lı değerlerin yırtılmadan okunması (AVR'de kesme kilidiyle)
+// Tear-free load of multi-byte values (with an interrupt lock on AVR)
+template<typename T>
+static inline T stardustAtomicLoad(const T* target) {
+#if defined(__AVR__)
+    const uint8_t sreg = SREG;
+    cli();
+    const T value = *(const volatile T*)target;
+    SREG = sreg;
+    return value;
+#else
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Sayaçlar için kilitsiz artırma // Lock-free increment for counters
+template<typename T>
+static inline void stardustAtomicIncrement(T* target) {
+    T expected = stardustAtomicLoad(target);
+    while (!stardustCompareExchange(target, expected, (T)(expected + 1))) {}
+}
+
+// Kilitsiz azami değer güncellemesi // Lock-free maximum update
+template<typename T>
+static inline void stardustAtomicMax(T* target, T value) {
+    T expected = stardustAtomicLoad(target);
+    while (value > expected && !stardustCompareExchange(target, expected, value)) {}
+}
+
+template<size_t SIZE>
+class StarDustByteRing {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "StarDustByteRing size must be a power of two");
+    static_assert(SIZE <= ((StarDustRingIndex)~(StarDustRingIndex)0 >> 1) + 1, "StarDustByteRing size too large for the index type");
+
+public:
+    StarDustByteRing() : _head(0), _tail(0) {}
+
+    // ==== ÜRETİCİ (ISR / DMA) ====
+    // ==== PRODUCER (ISR / DMA) ====
+    // Sığan kadar byte yazar, yazılan byte sayısını döndürür
+    // Writes as many bytes as fit, returns the number of bytes written
+    size_t push(const uint8_t* data, size_t length) {
+        const StarDustRingIndex head = _head; // Yalnızca üretici yazar // Only the producer writes it
+        const StarDustRingIndex tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+        const size_t space = SIZE - (StarDustRingIndex)(head - tail);
+        if (length > space) length = space;
+
+        const size_t offset = head & (SIZE - 1);
+        const size_t first = (length < SIZE - offset) ? length : SIZE - offset;
+        memcpy(&_data[offset], data, first);
+        memcpy(&_data[0], data + first, length - first);
+
+        __atomic_store_n(&_head, (StarDustRingIndex)(head + length), __ATOMIC_RELEASE);
+        return length;
+    }
+
+    // ==== TÜKETİCİ ====
+    // ==== CONSUMER ====
+    // Okunabilir ilk bitişik bölgeyi verir; işlendikten sonra consume() çağrılmalıdır
+    // Returns the first contiguous readable region; call consume() after processing it
+    size_t peekSpan(const uint8_t** data) const {
+        const StarDustRingIndex tail = _tail; // Yalnızca tüketici yazar // Only the consumer writes it
+        const StarDustRingIndex head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+        const size_t used = (StarDustRingIndex)(head - tail);
+        const size_t offset = tail & (SIZE - 1);
+        *data = &_data[offset];
+        return (used < SIZE - offset) ? used : SIZE - offset;
+    }
+
+    void consume(size_t length) {
+        __atomic_store_n(&_tail, (StarDustRingIndex)(_tail + length), __ATOMIC_RELEASE);
+    }
+
+    bool empty() const {
+        return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) == _tail;
+    }
+
+    void clear() {
+        __atomic_store_n(&_tail, __atomic_load_n(&_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+
+private:
+    uint8_t _data[SIZE];
+    StarDustRingIndex _head; // Üretici // Producer
+    StarDustRingIndex _tail; // Tüketici // Consumer
+};
+
+/* ======================================================= */
+/* ============== ÇERÇEVE YUVASI HALKASI ==================*/
+/* ================= FRAME SLOT RING ======================*/
+/* ======================================================= */
+// Çok üretici / tek tüketici. Her yuvanın bir sıra numarası vardır:
+//   seq == pos       -> yuva boş, pos konumundaki üretici alabilir
+//   seq == pos + 1   -> yuva yayınlandı, tüketici okuyabilir
+// Üretici reserve() ile yuvayı ayırır, yerinde doldurur ve publish() ile yayınlar.
+// Tüketici yuvaları ayrılma sırasıyla alır; yazımı süren bir yuva sonrakileri bekletir.
+// Multi-producer / single-consumer. Every slot carries a sequence number:
+//   seq == pos       -> slot is free, the producer at position pos may take it
+//   seq == pos + 1   -> slot is published, the consumer may read it
+// A producer claims a slot with reserve(), fills it in place and publishes it with publish().
+// The consumer takes slots in reservation order; a slot still being filled holds back later ones.
+template<typename T, size_t DEPTH>
+class StarDustSlotRing {
+    static_assert(DEPTH >= 1 && (DEPTH & (DEPTH - 1)) == 0, "StarDustSlotRing depth must be a power of two");
+    static_assert(DEPTH <= ((StarDustRingIndex)~(StarDustRingIndex)0 >> 1) + 1, "StarDustSlotRing depth too large for the index type");
+
+public:
+    StarDustSlotRing() : _head(0), _tail(0) {
+        for (size_t i = 0; i < DEPTH; i++) _seq[i] = i;
+    }
+
+    // ==== ÜRETİCİLER (birden çok görev veya kesme) ====
+    // ==== PRODUCERS (several tasks or interrupts) ====
+    // Boş yuva yoksa nullptr döner, hiçbir zaman beklemez
+    // Returns nullptr when there is no free slot, never waits
+    T* reserve() {
+        StarDustRingIndex pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+        for (;;) {
+            const StarDustRingIndex seq = __atomic_load_n(&_seq[pos & (DEPTH - 1)], __ATOMIC_ACQUIRE);
+            const StarDustRingDiff diff = (StarDustRingDiff)(StarDustRingIndex)(seq - pos);
+            if (diff == 0) {
+                if (stardustCompareExchange(&_head, pos, (StarDustRingIndex)(pos + 1))) {
+                    return &_slots[pos & (DEPTH - 1)];
+                }
+            } else if (diff < 0) {
+                return nullptr; // Halka dolu (yuva henüz boşaltılmadı) // Ring is full (slot not released yet)
+            } else {
+                pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    void publish(T* slot) {
+        const size_t index = slot - _slots;
+        __atomic_store_n(&_seq[index], (StarDustRingIndex)(_seq[index] + 1), __ATOMIC_RELEASE);
+    }
+
+    // ==== TÜKETİCİ (tek yazıcı) ====
+    // ==== CONSUMER (single writer) ====
+    T* front() {
+        const StarDustRingIndex seq = __atomic_load_n(&_seq[_tail & (DEPTH - 1)], __ATOMIC_ACQUIRE);
+        if (seq != (StarDustRingIndex)(_tail + 1)) return nullptr;
+        return &_slots[_tail & (DEPTH - 1)];
+    }
+
+    void release() {
+        __atomic_store_n(&_seq[_tail & (DEPTH - 1)], (StarDustRingIndex)(_tail + DEPTH), __ATOMIC_RELEASE);
+        __atomic_store_n(&_tail, (StarDustRingIndex)(_tail + 1), __ATOMIC_RELEASE);
+    }
+
+    // Ayrılmış ama henüz yayınlanmamış yuvalar da sayılır. Önce tail okunur: head hiçbir zaman ondan geride kalmaz
+    // Slots that are reserved but not yet published are counted too. tail is read first: head never falls behind it
+    size_t size() const {
+        const StarDustRingIndex tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+        const size_t used = (StarDustRingIndex)(__atomic_load_n(&_head, __ATOMIC_ACQUIRE) - tail);
+        return (used < DEPTH) ? used : DEPTH;
+    }
+
+private:
+    T _slots[DEPTH];
+    StarDustRingIndex _seq[DEPTH];
+    StarDustRingIndex _head; // Üreticiler // Producers
+    StarDustRingIndex _tail; // Tüketici   // Consumer
+};
+
+#endif
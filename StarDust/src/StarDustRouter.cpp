@@ -0,0 +1,185 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Router
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustRouter.h"
+
+#if STARDUST_ROUTING
+StarDustRouter::StarDustRouter() {
+    memset(_ports, 0, sizeof(_ports));
+    _portCount = 0;
+    memset(_routes, NO_ROUTE, sizeof(_routes));
+    _flooding = false;
+    _window = 50;
+    _unicastWindow = false;
+    memset(_seen, 0, sizeof(_seen));
+    _seenNext = 0;
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint8_t StarDustRouter::addPort(StarDustCore& link) {
+    for (uint8_t i = 0; i < _portCount; i++) {
+        if (_ports[i] == &link) return i;
+    }
+    if (_portCount == STARDUST_ROUTER_PORTS) return NO_ROUTE; // Tablo dolu // Table full
+    _ports[_portCount] = &link;
+    link._router = this;
+    link._routerPort = _portCount;
+    return _portCount++;
+}
+
+bool StarDustRouter::addRoute(uint8_t target, uint8_t port) {
+    if (target == BROADCAST_ID || port >= _portCount) return false;
+    _routes[target] = port;
+    return true;
+}
+
+void StarDustRouter::removeRoute(uint8_t target) {
+    _routes[target] = NO_ROUTE;
+}
+
+void StarDustRouter::setFlooding(bool enabled) {
+    _flooding = enabled;
+}
+
+void StarDustRouter::setDuplicateWindow(uint16_t ms, bool unicast) {
+    _window = ms;
+    _unicastWindow = unicast;
+}
+
+uint8_t StarDustRouter::update() {
+    // Çerçeveler ayrıştırıldıkları update() içinde iletilir; burada yalnızca kuyrukta kalanlar gider
+    // Frames are forwarded inside the update() that parses them; only what waits in a queue goes out here
+    for (uint8_t i = 0; i < _portCount; i++) _ports[i]->update();
+    return flush();
+}
+
+uint8_t StarDustRouter::flush() {
+    uint8_t waiting = 0;
+    for (uint8_t i = 0; i < _portCount; i++) {
+        for (Frame* frame; (frame = _queues[i].front()) != nullptr;) {
+            if (!_ports[i]->sendRaw(frame->bytes, frame->length)) break; // Port dolu, sıra korunur // Port full, the order is kept
+            _queues[i].release();
+        }
+        waiting += _queues[i].size();
+    }
+    return waiting;
+}
+
+uint8_t StarDustRouter::queued(uint8_t port) const {
+    return (port < _portCount) ? _queues[port].size() : 0;
+}
+
+const StarDustRouter::Stats& StarDustRouter::stats() const {
+    return _stats;
+}
+
+void StarDustRouter::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void StarDustRouter::transit(uint8_t inPort, const uint8_t* frame, uint8_t length) {
+    const PacketHeader& header = *(const PacketHeader*)frame;
+    uint16_t crc;
+    memcpy(&crc, frame + length - sizeof(crc), sizeof(crc));
+    if (seen(header, crc)) {
+        _stats.duplicates++;
+        return;
+    }
+
+    if (header.target != BROADCAST_ID) {
+        forward(inPort, _routes[header.target], frame, length);
+        return;
+    }
+    for (uint8_t i = 0; i < _portCount; i++) {
+        if (i != inPort) forward(inPort, i, frame, length);
+    }
+}
+
+bool StarDustRouter::seen(const PacketHeader& header, uint16_t crc) {
+    if (_window == 0 || (header.target != BROADCAST_ID && !_unicastWindow)) return false;
+    // CRC düz metin üzerindedir: yeniden şifrelenen kopya da aynı imzayı taşır
+    // The CRC is over the plaintext: a copy that was encrypted again carries the same signature
+    const uint32_t now = millis();
+    for (uint8_t i = 0; i < STARDUST_ROUTER_HISTORY; i++) {
+        const Seen& entry = _seen[i];
+        if (entry.used && entry.crc == crc && entry.source == header.source && entry.target == header.target &&
+            entry.type == header.type && now - entry.time < _window) {
+            return true;
+        }
+    }
+    Seen& entry = _seen[_seenNext];
+    _seenNext = (_seenNext + 1) % STARDUST_ROUTER_HISTORY;
+    entry.time = now;
+    entry.crc = crc;
+    entry.source = header.source;
+    entry.target = header.target;
+    entry.type = header.type;
+    entry.used = true;
+    return false;
+}
+
+void StarDustRouter::forward(uint8_t inPort, uint8_t outPort, const uint8_t* frame, uint8_t length) {
+    // Payload, alıcının kaynak için kullandığı anahtarla şifreli olmalıdır: portların anahtarı aynıysa dokunulmaz
+    // The payload must be encrypted with the key the receiver uses for the source: with equal port keys it is not touched
+#if STARDUST_CIPHER_MODE != STARDUST_CIPHER_NONE
+    const uint8_t source = ((const PacketHeader*)frame)->source;
+    // Anahtarsız (şifresiz) port düz metin taşır // A port without a key (unencrypted) carries plain text
+    const StarDustCipher::Schedule* inKey = _ports[inPort]->keyFor(source);
+    const StarDustCipher::Schedule* outKey = _ports[outPort]->keyFor(source);
+    uint8_t copy[sizeof(PacketData)];
+    if ((inKey == nullptr) != (outKey == nullptr) || (inKey != nullptr && memcmp(inKey, outKey, sizeof(*inKey)) != 0)) {
+        memcpy(copy, frame, length);
+        uint8_t* payload = copy + sizeof(PacketHeader);
+        const uint8_t size = length - sizeof(PacketHeader) - sizeof(uint16_t);
+        if (inKey != nullptr) StarDustCipher::decrypt(*inKey, payload, size);
+        if (outKey != nullptr) StarDustCipher::encrypt(*outKey, payload, size);
+        frame = copy;
+        _stats.rekeyed++;
+    }
+#endif
+
+    // Kuyruk boşsa çerçeve hemen yazılır; port kabul etmezse veya önünde bekleyen varsa sıraya girer
+    // With an empty queue the frame is written at once; if the port refuses it or others wait ahead, it queues
+    StarDustSlotRing<Frame, STARDUST_ROUTER_QUEUE_DEPTH>& queue = _queues[outPort];
+    if (queue.size() == 0 && _ports[outPort]->sendRaw(frame, length)) {
+        _stats.forwarded++;
+        return;
+    }
+    Frame* slot = queue.reserve();
+    if (slot == nullptr) {
+        _stats.dropped++;
+        return;
+    }
+    memcpy(slot->bytes, frame, length);
+    slot->length = length;
+    queue.publish(slot);
+    _stats.forwarded++;
+}
+#endif
@@ -0,0 +1,174 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Router
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Forwards frames between several StarDust ports (e.g. an RS-485 bus and a UART radio) so
+that nodes on different links can reach each other by ID. A static routing table maps
+each target ID to an output port. When a frame header arrives for a foreign target that
+has a route on another port, the parser keeps the payload encrypted and hands the
+finished frame to the router as it came off the wire: source, target and CRC are kept,
+and the payload is only decrypted and encrypted again when the two ports hold different
+keys for the source. Each output port has its own forwarding queue, so a slow link
+holds back only its own traffic.
+
+The header carries no hop count, so loops are stopped in two ways: a frame is never
+sent back out of the port it arrived on, and a flooded broadcast seen a moment ago (same
+source, target, type and CRC) is dropped; the same check can be turned on for unicast
+frames against a misconfigured table. All state is static.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_ROUTER_H
+#define STARDUST_ROUTER_H
+
+#include "StarDust.h"
+
+// Yönlendiriciye bağlanabilecek port sayısı // Number of ports that can be bound to a router
+#ifndef STARDUST_ROUTER_PORTS
+    #if defined(__AVR__)
+        #define STARDUST_ROUTER_PORTS 2
+    #else
+        #define STARDUST_ROUTER_PORTS 8
+    #endif
+#endif
+static_assert(STARDUST_ROUTER_PORTS >= 1 && STARDUST_ROUTER_PORTS < 255, "STARDUST_ROUTER_PORTS must be 1..254");
+
+// Port başına iletim kuyruğu derinliği (2'nin kuvveti) // Forwarding queue depth per port (power of two)
+#ifndef STARDUST_ROUTER_QUEUE_DEPTH
+    #if defined(__AVR__)
+        #define STARDUST_ROUTER_QUEUE_DEPTH 2
+    #else
+        #define STARDUST_ROUTER_QUEUE_DEPTH 16
+    #endif
+#endif
+
+// Döngü koruması için hatırlanan son çerçeveler // Recent frames remembered for loop protection
+#ifndef STARDUST_ROUTER_HISTORY
+    #if defined(__AVR__)
+        #define STARDUST_ROUTER_HISTORY 8
+    #else
+        #define STARDUST_ROUTER_HISTORY 32
+    #endif
+#endif
+
+#if STARDUST_ROUTING
+class StarDustRouter {
+public:
+    struct Stats {
+        uint32_t forwarded;   // Çıkış portuna verilen kopyalar // Copies handed to an output port
+        uint32_t rekeyed;     // Port anahtarları farklı olduğu için yeniden şifrelenen // Encrypted again because the port keys differ
+        uint32_t duplicates;  // Döngü koruması: az önce iletilmiş çerçeve // Loop protection: frame forwarded a moment ago
+        uint32_t dropped;     // Çıkış kuyruğu dolu // Output queue full
+    };
+
+    static constexpr uint8_t NO_ROUTE = 0xFF;
+
+    StarDustRouter();
+
+    // Port numarasını döndürür (tablo doluysa NO_ROUTE). Portun adres süzgeci VALIDATE veya EARLY olmalıdır:
+    // PROMISCUOUS bir port her çerçeveyi kendine alır ve hiçbirini iletmez.
+    // Returns the port number (NO_ROUTE when the table is full). The address filter of the port must be VALIDATE
+    // or EARLY: a PROMISCUOUS port takes every frame for itself and forwards none.
+    uint8_t addPort(StarDustCore& link);
+
+    // target ID'ye giden çerçeveler port üzerinden iletilir; hedefin bulunduğu bağlantıdaki port da kaydedilmelidir,
+    // o porttan gelen ve aynı bağlantıda kalan çerçeveler böylece iletilmez
+    // Frames for the target ID are forwarded through port; the port on the target's own link must be entered too,
+    // so frames that arrive there and stay on that link are not forwarded
+    bool addRoute(uint8_t target, uint8_t port);
+    void removeRoute(uint8_t target);
+    uint8_t route(uint8_t target) const { return _routes[target]; }
+
+    // Genel yayınlar geldikleri port dışındaki tüm portlara kopyalanır (varsayılan kapalı)
+    // Broadcasts are copied to every port but the one they arrived on (off by default)
+    void setFlooding(bool enabled);
+    // Aynı kaynak, hedef, tip ve CRC'li genel yayın bu süre içinde ikinci kez gelirse atılır (0 = kapalı, varsayılan
+    // 50 ms). unicast: tekil çerçeveler de denetlenir; yanlış tablonun döngüsünü keser ama bu süre içinde tekrarlanan
+    // aynı çerçeveyi (ör. aynı yoklama, hızlı yeniden gönderim) de atar.
+    // A broadcast with the same source, target, type and CRC arriving again within this time is dropped (0 = off,
+    // default 50 ms). unicast: single target frames are checked too; this breaks the loop of a wrong table but also
+    // drops an identical frame repeated within the time (e.g. the same poll, a fast retransmission).
+    void setDuplicateWindow(uint16_t ms, bool unicast = false);
+
+    // Tüm portlarda update() ve bekleyen iletimler; ana döngüden çağrılmalıdır. Yerel paketler her porttan
+    // her zamanki gibi dispatch() veya pop() ile alınır. Kuyruklarda bekleyen çerçeve sayısını döndürür.
+    // update() on every port and the pending forwards; call it from the main loop. Local packets are taken from
+    // each port as usual with dispatch() or pop(). Returns the number of frames waiting in the queues.
+    uint8_t update();
+    uint8_t flush();                      // Yalnızca bekleyen iletimler // Only the pending forwards
+    uint8_t queued(uint8_t port) const;
+
+    const Stats& stats() const;
+    void resetStats();
+
+private:
+    friend class StarDustCore;
+
+    struct Frame {
+        uint8_t length;
+        uint8_t bytes[sizeof(PacketData)]; // Çerçevelemesiz, payload şifreli // Without framing, payload encrypted
+    };
+    struct Seen {
+        uint32_t time;        // ms
+        uint16_t crc;
+        uint8_t source;
+        uint8_t target;
+        uint8_t type;
+        bool used;
+    };
+
+    StarDustCore* _ports[STARDUST_ROUTER_PORTS];
+    StarDustSlotRing<Frame, STARDUST_ROUTER_QUEUE_DEPTH> _queues[STARDUST_ROUTER_PORTS];
+    uint8_t _portCount;
+    uint8_t _routes[256];     // Hedef ID -> port (NO_ROUTE = yol yok) // Target ID -> port (NO_ROUTE = no route)
+    bool _flooding;
+    uint16_t _window;
+    bool _unicastWindow;
+    Seen _seen[STARDUST_ROUTER_HISTORY];
+    uint8_t _seenNext;
+    Stats _stats;
+
+    // Ayrıştırıcı başlık gelir gelmez sorar: bu hedef başka bir porttan iletilir mi
+    // The parser asks as soon as the header is in: is this target forwarded through another port
+    bool routes(uint8_t inPort, uint8_t target) const {
+        if (target == BROADCAST_ID) return _flooding && _portCount > 1;
+        return _routes[target] != NO_ROUTE && _routes[target] != inPort;
+    }
+    void transit(uint8_t inPort, const uint8_t* frame, uint8_t length);
+    bool seen(const PacketHeader& header, uint16_t crc);
+    void forward(uint8_t inPort, uint8_t outPort, const uint8_t* frame, uint8_t length);
+};
+#endif
+
+#endif
@@ -0,0 +1,286 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Bus Scheduler
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustScheduler.h"
+
+StarDustScheduler::StarDustScheduler() {
+    _link = nullptr;
+    _timeoutHandler = nullptr;
+    _timeoutContext = nullptr;
+    _poll.version = 1;
+    _poll.requestType = 0;
+    _poll.isCritical = false;
+    _minSlot = 2000UL;
+    _maxSlot = 100000UL;
+    _offlinePeriod = 1000000UL;
+    _guard = 0;
+    _offlineMisses = 3;
+    _paused = false;
+    _current = nullptr;
+    _pollTime = 0;
+    _freeTime = 0;
+    _answered = BROADCAST_ID;
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_slaves, 0, sizeof(_slaves));
+}
+
+void StarDustScheduler::begin(StarDustCore& link) {
+    _link = &link;
+    link.onDispatch(&StarDustScheduler::onFrame, this);
+    _freeTime = micros();
+}
+
+void StarDustScheduler::setPollRequest(uint8_t version, uint8_t requestType) {
+    _poll.version = version;
+    _poll.requestType = requestType;
+}
+
+void StarDustScheduler::setResponseTimeout(uint16_t minMs, uint16_t maxMs) {
+    _minSlot = (uint32_t)minMs * 1000UL;
+    _maxSlot = (uint32_t)((maxMs > minMs) ? maxMs : minMs) * 1000UL;
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES; i++) {
+        Slave& slave = _slaves[i];
+        if (!slave.measured || slave.slot > _maxSlot) slave.slot = _maxSlot;
+        if (slave.slot < _minSlot) slave.slot = _minSlot;
+    }
+}
+
+void StarDustScheduler::setGuardTime(uint16_t us) {
+    _guard = us;
+}
+
+void StarDustScheduler::setOfflinePolicy(uint8_t misses, uint16_t intervalMs) {
+    _offlineMisses = misses;
+    _offlinePeriod = (uint32_t)intervalMs * 1000UL;
+}
+
+void StarDustScheduler::onTimeout(TimeoutHandler handler, void* context) {
+    _timeoutHandler = handler;
+    _timeoutContext = context;
+}
+
+void StarDustScheduler::pause() {
+    _paused = true;
+}
+
+void StarDustScheduler::resume() {
+    _paused = false;
+}
+
+const StarDustScheduler::Stats& StarDustScheduler::stats() const {
+    return _stats;
+}
+
+void StarDustScheduler::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+// ======================== SLAVE TABLOSU ========================
+// ======================== SLAVE TABLE ==========================
+StarDustScheduler::Slave* StarDustScheduler::findSlave(uint8_t id) {
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES; i++) {
+        if (_slaves[i].used && _slaves[i].id == id) return &_slaves[i];
+    }
+    return nullptr;
+}
+
+const StarDustScheduler::Slave* StarDustScheduler::findSlave(uint8_t id) const {
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES; i++) {
+        if (_slaves[i].used && _slaves[i].id == id) return &_slaves[i];
+    }
+    return nullptr;
+}
+
+bool StarDustScheduler::addSlave(uint8_t id, uint16_t periodMs, uint8_t priority) {
+    if (id == BROADCAST_ID) return false;
+    Slave* slave = findSlave(id);
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES && slave == nullptr; i++) {
+        if (!_slaves[i].used) {
+            slave = &_slaves[i];
+            memset(slave, 0, sizeof(*slave));
+            slave->id = id;
+            slave->used = true;
+            slave->slot = _maxSlot;
+            slave->nextDue = micros(); // İlk yoklama hemen // First poll right away
+        }
+    }
+    if (slave == nullptr) return false; // Tablo dolu // Table full
+    slave->period = (uint32_t)periodMs * 1000UL;
+    slave->priority = priority;
+    return true;
+}
+
+bool StarDustScheduler::removeSlave(uint8_t id) {
+    Slave* slave = findSlave(id);
+    if (slave == nullptr) return false;
+    if (_current == slave) _current = nullptr; // Geç yanıt outOfSlot sayılmaz // A late answer is not counted as outOfSlot
+    slave->used = false;
+    return true;
+}
+
+bool StarDustScheduler::idle() const {
+    return _current == nullptr;
+}
+
+uint8_t StarDustScheduler::polling() const {
+    return (_current != nullptr) ? _current->id : BROADCAST_ID;
+}
+
+bool StarDustScheduler::online(uint8_t id) const {
+    const Slave* slave = findSlave(id);
+    return slave != nullptr && (_offlineMisses == 0 || slave->misses < _offlineMisses);
+}
+
+uint32_t StarDustScheduler::responseTime(uint8_t id) const {
+    const Slave* slave = findSlave(id);
+    return (slave != nullptr && slave->measured) ? slave->srtt : 0;
+}
+
+uint32_t StarDustScheduler::slotTime(uint8_t id) const {
+    const Slave* slave = findSlave(id);
+    return (slave != nullptr) ? slave->slot : 0;
+}
+
+uint16_t StarDustScheduler::timeouts(uint8_t id) const {
+    const Slave* slave = findSlave(id);
+    return (slave != nullptr) ? slave->timeouts : 0;
+}
+
+// ======================== ZAMANLAMA ========================
+// ======================== SCHEDULING =======================
+StarDustScheduler::Slave* StarDustScheduler::nextSlave(uint32_t now) {
+    // Zamanı gelenlerden en yüksek öncelikli; eşitlikte en çok gecikmiş (period 0 olanlar sırayla döner)
+    // The highest priority among the due ones; on a tie the most overdue (period 0 slaves take turns)
+    Slave* best = nullptr;
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES; i++) {
+        Slave& slave = _slaves[i];
+        if (!slave.used || (int32_t)(now - slave.nextDue) < 0) continue;
+        if (best == nullptr || slave.priority > best->priority ||
+            (slave.priority == best->priority && (int32_t)(slave.nextDue - best->nextDue) < 0)) {
+            best = &slave;
+        }
+    }
+    return best;
+}
+
+uint32_t StarDustScheduler::unmeasuredSlot() const {
+    // Ölçülmemiş veya çevrimdışı slave, çevrimiçi en yavaş slave'in iki katı kadar bekletilir
+    // An unmeasured or offline slave gets twice the slot of the slowest online slave
+    uint32_t widest = 0;
+    for (uint8_t i = 0; i < STARDUST_SCHEDULER_SLAVES; i++) {
+        const Slave& slave = _slaves[i];
+        const bool offline = _offlineMisses > 0 && slave.misses >= _offlineMisses;
+        if (slave.used && slave.measured && !offline && slave.slot > widest) widest = slave.slot;
+    }
+    if (widest == 0 || widest > _maxSlot / 2) return _maxSlot;
+    return (2 * widest < _minSlot) ? _minSlot : 2 * widest;
+}
+
+void StarDustScheduler::poll(Slave& slave, uint32_t now) {
+    if (!_link->sendPayload(slave.id, REQUEST, &_poll, sizeof(_poll))) return; // Gönderim kuyruğu dolu: sonraki update() // Transmit queue full: next update()
+#if STARDUST_AGGREGATION
+    _link->flushBatch(); // Yoklama toplamada beklemez // The poll does not wait in a batch
+#endif
+    // Cevap vermeyen slave seyrek ve kısa slot'la yoklanır; geride kalan slave kaçırdığı turları art arda almaz
+    // A silent slave is polled rarely and with a short slot; a slave that fell behind does not get its missed turns back to back
+    const bool offline = _offlineMisses > 0 && slave.misses >= _offlineMisses;
+    if (offline || (!slave.measured && slave.misses == 0)) slave.slot = unmeasuredSlot();
+    _current = &slave;
+    _pollTime = now;
+    _answered = BROADCAST_ID;
+    _stats.polls++;
+
+    const uint32_t period = offline ? _offlinePeriod : slave.period;
+    slave.nextDue += period;
+    if ((int32_t)(now - slave.nextDue) >= 0) slave.nextDue = now + period;
+}
+
+void StarDustScheduler::sampleResponse(Slave& slave, uint32_t now) {
+    const uint32_t sample = now - _pollTime;
+    if (!slave.measured) {
+        slave.srtt = sample;
+        slave.rttvar = sample / 2;
+        slave.measured = true;
+    } else {
+        const uint32_t delta = (slave.srtt > sample) ? slave.srtt - sample : sample - slave.srtt;
+        slave.rttvar = (3 * slave.rttvar + delta) / 4;
+        slave.srtt = (7 * slave.srtt + sample) / 8;
+    }
+    uint32_t slot = slave.srtt + 4 * slave.rttvar;
+    if (slot < _minSlot) slot = _minSlot;
+    if (slot > _maxSlot) slot = _maxSlot;
+    slave.slot = slot;
+    slave.misses = 0;
+}
+
+void StarDustScheduler::missed(Slave& slave, uint32_t now) {
+    // Yanıt bu slot'a sığmadı: slot iki katına çıkar (en çok maxMs), geç yanıt zamanlamayı bozmasın
+    // The answer did not fit into the slot: the slot doubles (at most maxMs) so late answers stop overlapping
+    const bool offline = _offlineMisses > 0 && slave.misses >= _offlineMisses;
+    if (!offline) slave.slot = (slave.slot > _maxSlot / 2) ? _maxSlot : slave.slot * 2;
+    slave.timeouts++;
+    if (slave.misses < 255) slave.misses++;
+    _stats.timeouts++;
+    _current = nullptr;
+    _freeTime = now;
+    if (_timeoutHandler != nullptr) _timeoutHandler(slave.id, slave.misses, _timeoutContext);
+}
+
+void StarDustScheduler::onFrame(const PacketData& packet, void* context) {
+    StarDustScheduler* self = static_cast<StarDustScheduler*>(context);
+    const uint8_t source = packet.header.source;
+    if (self->_current != nullptr && self->_current->id == source) {
+        const uint32_t now = micros();
+        self->sampleResponse(*self->_current, now);
+        self->_current = nullptr;
+        self->_answered = source;
+        self->_freeTime = now;
+        self->_stats.responses++;
+    } else if (source != self->_answered && self->findSlave(source) != nullptr) {
+        // Aynı yanıt çerçevesindeki toplanmış kayıtlar sayılmaz // Aggregated records of the same answer frame are not counted
+        self->_stats.outOfSlot++;
+    }
+}
+
+uint8_t StarDustScheduler::update() {
+    if (_link == nullptr) return 0;
+    const uint8_t handled = _link->dispatch();
+
+    const uint32_t now = micros();
+    if (_current != nullptr && now - _pollTime >= _current->slot) missed(*_current, now);
+
+    // Yanıt geldiği update() içinde sıradaki yoklama gider: hatta boş slot kalmaz
+    // The next poll goes out in the update() that brought the answer: no idle slots on the line
+    if (_current == nullptr && !_paused && now - _freeTime >= _guard) {
+        Slave* next = nextSlave(now);
+        if (next != nullptr) poll(*next, now);
+    }
+    return handled;
+}
@@ -0,0 +1,155 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Bus Scheduler
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Master side polling for a half-duplex bus with many slaves. The master keeps a table of
+slave IDs with a poll period and a priority and hands the bus to one slave at a time with
+a REQUEST poll; a slave speaks only when polled and answers with one frame. The next poll
+goes out as soon as the answer is in, so the line carries no idle slots. A slave that does
+not answer in time loses its slot: the timeout follows the measured response time of each
+slave (smoothed mean + 4 x deviation), and slaves that miss several polls in a row are
+polled only now and then until they answer again. All state is static.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_SCHEDULER_H
+#define STARDUST_SCHEDULER_H
+
+#include "StarDust.h"
+
+// Tablodaki azami slave sayısı // Maximum number of slaves in the table
+#ifndef STARDUST_SCHEDULER_SLAVES
+    #if defined(__AVR__)
+        #define STARDUST_SCHEDULER_SLAVES 8
+    #else
+        #define STARDUST_SCHEDULER_SLAVES 32
+    #endif
+#endif
+
+class StarDustScheduler {
+public:
+    struct Stats {
+        uint32_t polls;
+        uint32_t responses;
+        uint32_t timeouts;
+        uint32_t outOfSlot;   // Yoklanmayan slave'den gelen çerçeveler (geç yanıtlar dahil) // Frames from a slave that was not polled (late answers included)
+    };
+
+    typedef void (*TimeoutHandler)(uint8_t slave, uint8_t misses, void* context);
+
+    StarDustScheduler();
+
+    // Bağlantının onDispatch() gözlemcisini kullanır // Uses the onDispatch() observer of the link
+    void begin(StarDustCore& link);
+
+    // periodMs: iki yoklama arası en kısa süre (0 = her boş slotta); büyük öncelik önce yoklanır
+    // periodMs: shortest time between two polls (0 = every free slot); higher priority is polled first
+    bool addSlave(uint8_t id, uint16_t periodMs = 0, uint8_t priority = 0);
+    bool removeSlave(uint8_t id);
+
+    // Yoklamanın REQUEST içeriği (requestType slave'e ne istendiğini söyler)
+    // REQUEST content of the poll (requestType tells the slave what is asked)
+    void setPollRequest(uint8_t version, uint8_t requestType);
+    // Uyarlanabilir yanıt süresinin sınırları; hiçbir slave ölçülmeden önce maxMs kullanılır
+    // Bounds of the adaptive response timeout; maxMs is used before any slave is measured
+    void setResponseTimeout(uint16_t minMs, uint16_t maxMs);
+    // Yanıttan sonra sonraki yoklamaya kadar beklenen süre (RS-485 sürücü dönüşü)
+    // Time waited after an answer before the next poll (RS-485 driver turnaround)
+    void setGuardTime(uint16_t us);
+    // Art arda misses kez yanıt vermeyen slave, yanıt verene kadar intervalMs'de bir yoklanır
+    // A slave that misses this many polls in a row is polled once every intervalMs until it answers
+    void setOfflinePolicy(uint8_t misses, uint16_t intervalMs);
+    void onTimeout(TimeoutHandler handler, void* context = nullptr);
+
+    void pause();                     // Açık yoklama bitince yeni yoklama yapılmaz // No new polls after the open one ends
+    void resume();
+
+    // link.dispatch(), zaman aşımları ve sıradaki yoklama; ana döngüden çağrılmalıdır
+    // link.dispatch(), timeouts and the next poll; call it from the main loop
+    uint8_t update();
+
+    bool idle() const;                // Açık yoklama yok: master hatta yazabilir // No open poll: the master may write to the line
+    uint8_t polling() const;          // Yoklanan slave (yoksa BROADCAST_ID) // The polled slave (BROADCAST_ID if none)
+    bool online(uint8_t id) const;
+    uint32_t responseTime(uint8_t id) const; // Düzgünleştirilmiş yanıt süresi (µs, 0 = ölçülmedi) // Smoothed response time (µs, 0 = not measured)
+    uint32_t slotTime(uint8_t id) const;     // Bu slave'e tanınan süre (µs) // Time granted to this slave (µs)
+    uint16_t timeouts(uint8_t id) const;     // Bu slave'in kaçırdığı yoklamalar (döner) // Polls missed by this slave (wraps)
+    const Stats& stats() const;
+    void resetStats();
+
+private:
+    struct Slave {
+        uint32_t period;      // µs
+        uint32_t nextDue;     // µs
+        uint32_t srtt;        // Düzgünleştirilmiş yanıt süresi (µs) // Smoothed response time (µs)
+        uint32_t rttvar;
+        uint32_t slot;        // Zaman aşımı (µs) // Timeout (µs)
+        uint16_t timeouts;
+        uint8_t id;
+        uint8_t priority;
+        uint8_t misses;       // Art arda // In a row
+        bool used;
+        bool measured;
+    };
+
+    StarDustCore* _link;
+    TimeoutHandler _timeoutHandler;
+    void* _timeoutContext;
+    RequestPayload _poll;
+    uint32_t _minSlot;
+    uint32_t _maxSlot;
+    uint32_t _offlinePeriod;
+    uint16_t _guard;
+    uint8_t _offlineMisses;
+    bool _paused;
+
+    Slave* _current;          // Açık yoklama // Open poll
+    uint32_t _pollTime;
+    uint32_t _freeTime;       // Hattın boşaldığı an // When the line became free
+    uint8_t _answered;        // Son yanıt veren (toplanmış kayıtları için) // The last one that answered (for its aggregated records)
+    Stats _stats;
+    Slave _slaves[STARDUST_SCHEDULER_SLAVES];
+
+    Slave* findSlave(uint8_t id);
+    const Slave* findSlave(uint8_t id) const;
+    Slave* nextSlave(uint32_t now);
+    uint32_t unmeasuredSlot() const;
+    void poll(Slave& slave, uint32_t now);
+    void sampleResponse(Slave& slave, uint32_t now);
+    void missed(Slave& slave, uint32_t now);
+
+    static void onFrame(const PacketData& packet, void* context);
+};
+
+#endif
@@ -0,0 +1,283 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Link Timing
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustTiming.h"
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+// Kayma en az bu kadar süre (µs) üzerinden ölçülür: kısa aralıkta ölçüm gürültüsü kaymayı bastırır
+// The drift is measured over at least this long (µs): over a short span the measurement noise drowns it
+static constexpr uint32_t DRIFT_SPAN = 10000000UL;
+
+StarDustTiming::StarDustTiming() {
+    _link = nullptr;
+    _heartbeat = nullptr;
+    _heartbeatContext = nullptr;
+    _clock = &StarDustTiming::defaultClock;
+    _interval = 1000000UL;
+    _minTimeout = 10;
+    _maxTimeout = 1000;
+    _nextPeer = 0;
+    memset(_peers, 0, sizeof(_peers));
+}
+
+void StarDustTiming::begin(StarDustCore& link) {
+    _link = &link;
+    link.onPacket<SYSTEMHEARTBEAT>(&StarDustTiming::onFrame, this);
+    link.setPeerTimeout(&StarDustTiming::peerTimeout, this);
+}
+
+void StarDustTiming::onHeartbeat(HeartbeatHandler handler, void* context) {
+    _heartbeat = handler;
+    _heartbeatContext = context;
+}
+
+bool StarDustTiming::addPeer(uint8_t id) {
+    if (id == BROADCAST_ID) return false; // Yayına yanıt tek bir eşten gelmez // A broadcast is not answered by a single peer
+    if (findPeer(id) != nullptr) return true;
+    for (uint8_t i = 0; i < STARDUST_TIMING_PEERS; i++) {
+        Peer& peer = _peers[i];
+        if (peer.used) continue;
+        memset(&peer, 0, sizeof(peer));
+        peer.id = id;
+        peer.used = true;
+        peer.lastPing = now() - _interval; // İlk yoklama hemen gider // The first ping goes out at once
+        return true;
+    }
+    return false; // Tablo dolu // Table full
+}
+
+bool StarDustTiming::removePeer(uint8_t id) {
+    Peer* peer = findPeer(id);
+    if (peer == nullptr) return false;
+    peer->used = false;
+    return true;
+}
+
+void StarDustTiming::setInterval(uint16_t ms) {
+    _interval = ms * 1000UL;
+}
+
+void StarDustTiming::setTimeoutBounds(uint16_t minMs, uint16_t maxMs) {
+    _minTimeout = minMs;
+    _maxTimeout = (maxMs < minMs) ? minMs : maxMs;
+}
+
+void StarDustTiming::setClock(Clock clock) {
+    _clock = (clock != nullptr) ? clock : &StarDustTiming::defaultClock;
+}
+
+StarDustTiming::Peer* StarDustTiming::findPeer(uint8_t id) {
+    for (uint8_t i = 0; i < STARDUST_TIMING_PEERS; i++) {
+        if (_peers[i].used && _peers[i].id == id) return &_peers[i];
+    }
+    return nullptr;
+}
+
+const StarDustTiming::Peer* StarDustTiming::findPeer(uint8_t id) const {
+    for (uint8_t i = 0; i < STARDUST_TIMING_PEERS; i++) {
+        if (_peers[i].used && _peers[i].id == id) return &_peers[i];
+    }
+    return nullptr;
+}
+
+uint32_t StarDustTiming::now() const {
+    return _clock();
+}
+
+uint32_t StarDustTiming::defaultClock() {
+    return STARDUST_TIMING_CLOCK();
+}
+
+// ======================== YOKLAMA ========================
+// ======================== PROBES =========================
+bool StarDustTiming::sendProbe(uint8_t target, const HeartbeatSyncPayload& probe) {
+    if (!_link->sendPayload(target, SYSTEMHEARTBEAT, &probe, sizeof(probe))) return false;
+#if STARDUST_AGGREGATION
+    _link->flushBatch(); // Zaman damgası toplamada beklemez // The timestamp does not wait in a batch
+#endif
+    return true;
+}
+
+bool StarDustTiming::ping(uint8_t id) {
+    Peer* peer = findPeer(id);
+    if (id == BROADCAST_ID || peer == nullptr || _link == nullptr) return false;
+    HeartbeatSyncPayload probe = {STARDUST_HEARTBEAT_PING, (uint8_t)(peer->seq + 1), 0, 0, 0};
+    probe.transmit = now();
+    if (!sendProbe(id, probe)) return false; // Gönderim kuyruğu dolu: sonraki update() // Transmit queue full: next update()
+
+    if (peer->waiting) peer->estimate.lost++;
+    peer->waiting = true;
+    peer->seq = probe.seq;
+    peer->sentAt = probe.transmit;
+    peer->lastPing = probe.transmit;
+    return true;
+}
+
+uint8_t StarDustTiming::update() {
+    if (_link == nullptr) return 0;
+    const uint8_t handled = _link->dispatch();
+
+    // update() başına en çok bir yoklama: yoklamalar hatta yayılır
+    // At most one ping per update(): the pings are spread over the line
+    if (_interval > 0) {
+        const uint32_t time = now();
+        for (uint8_t i = 0; i < STARDUST_TIMING_PEERS; i++) {
+            const uint8_t index = (_nextPeer + i) % STARDUST_TIMING_PEERS;
+            Peer& peer = _peers[index];
+            if (peer.used && time - peer.lastPing >= _interval) {
+                if (ping(peer.id)) _nextPeer = (index + 1) % STARDUST_TIMING_PEERS;
+                break;
+            }
+        }
+    }
+    return handled;
+}
+
+void StarDustTiming::onFrame(const HeartbeatSyncPayload& payload, const PacketHeader& header, void* context) {
+    StarDustTiming* self = static_cast<StarDustTiming*>(context);
+    const uint32_t arrival = self->now();
+    // PING ve ECHO yalnızca bize adreslendiyse işlenir: yayın veya grup adresine gelen PING'e her düğüm yanıt verirdi
+    // PING and ECHO are handled only when addressed to us: every node would answer a PING sent to broadcast or a group
+    const bool control = payload.version == STARDUST_HEARTBEAT_PING || payload.version == STARDUST_HEARTBEAT_ECHO;
+    if (control && (self->_link == nullptr || header.target != self->_link->getID())) return;
+    if (payload.version == STARDUST_HEARTBEAT_PING) {
+        // Yanıt hemen gider; işleme süresi receive ile transmit arasında kalır ve gidiş-dönüşten düşülür
+        // The answer goes out at once; the processing time lies between receive and transmit and is taken off the round trip
+        HeartbeatSyncPayload echo = {STARDUST_HEARTBEAT_ECHO, payload.seq, payload.transmit, arrival, 0};
+        echo.transmit = self->now();
+        self->sendProbe(header.source, echo);
+    } else if (payload.version == STARDUST_HEARTBEAT_ECHO) {
+        // Yalnızca açık yoklamanın yanıtı sayılır; geç veya kopya ECHO'lar atılır
+        // Only the answer to the open ping counts; late or duplicate ECHOs are dropped
+        Peer* peer = self->findPeer(header.source);
+        if (peer != nullptr && peer->waiting && payload.seq == peer->seq && payload.origin == peer->sentAt) {
+            peer->waiting = false;
+            self->sample(*peer, payload, arrival);
+        }
+    } else if (self->_heartbeat != nullptr) {
+        self->_heartbeat(*reinterpret_cast<const SystemHeartbeatPayload*>(&payload), header, self->_heartbeatContext);
+    }
+}
+
+// ======================== ÖLÇÜM ========================
+// ======================== MEASUREMENT ==================
+void StarDustTiming::sample(Peer& peer, const HeartbeatSyncPayload& echo, uint32_t arrival) {
+    // NTP: gidiş-dönüş = (t4 - t1) - (t3 - t2), fark = (t2 - t1) - gidiş-dönüş / 2 (iki yön eşit sayılır).
+    // Saatler 32 bitte döner; farklar işaretsiz aritmetikle doğru kalır.
+    // NTP: round trip = (t4 - t1) - (t3 - t2), offset = (t2 - t1) - round trip / 2 (both directions taken as equal).
+    // The clocks wrap at 32 bits; the differences stay right with unsigned arithmetic.
+    const int32_t span = (int32_t)(arrival - echo.origin) - (int32_t)(echo.transmit - echo.receive);
+    const uint32_t delay = (span > 0) ? (uint32_t)span : 0;
+    const uint32_t offset = (echo.receive - echo.origin) - delay / 2;
+
+    Estimate& estimate = peer.estimate;
+    if (estimate.samples == 0) {
+        estimate.rttMin = delay;
+        estimate.rttMean = delay;
+        estimate.rttJitter = delay / 2;
+    } else {
+        if (delay < estimate.rttMin) estimate.rttMin = delay;
+        const uint32_t deviation = (estimate.rttMean > delay) ? estimate.rttMean - delay : delay - estimate.rttMean;
+        estimate.rttJitter = (3 * estimate.rttJitter + deviation) / 4;
+        estimate.rttMean = (7 * estimate.rttMean + delay) / 8;
+    }
+    estimate.samples++;
+    uint32_t timeout = (estimate.rttMean + 4 * estimate.rttJitter + 999) / 1000;
+    if (timeout < _minTimeout) timeout = _minTimeout;
+    if (timeout > _maxTimeout) timeout = _maxTimeout;
+    estimate.timeout = timeout;
+
+    // Saat süzgeci: penceredeki en kısa gidiş-dönüşlü örnek, kuyrukta en az bekleyendir
+    // Clock filter: the sample with the shortest round trip in the window waited least in queues
+    Sample& slot = peer.samples[peer.nextSample];
+    slot.time = echo.origin + (arrival - echo.origin) / 2;
+    slot.offset = offset;
+    slot.delay = delay;
+    peer.nextSample = (peer.nextSample + 1) % STARDUST_TIMING_SAMPLES;
+    if (peer.sampleCount < STARDUST_TIMING_SAMPLES) peer.sampleCount++;
+    const Sample* best = &peer.samples[0];
+    for (uint8_t i = 1; i < peer.sampleCount; i++) {
+        const Sample& candidate = peer.samples[i];
+        if (candidate.delay < best->delay || (candidate.delay == best->delay && (int32_t)(candidate.time - best->time) > 0)) {
+            best = &candidate;
+        }
+    }
+
+    // Kayma: seçilen örneklerin farkının zamana göre eğimi, 1/4 ile düzgünleştirilir
+    // Drift: slope of the offset of the chosen samples over time, smoothed with 1/4
+    if (!peer.anchored) {
+        peer.anchorTime = best->time;
+        peer.anchorOffset = best->offset;
+        peer.anchored = true;
+    } else if (best->time - peer.anchorTime >= DRIFT_SPAN) {
+        const float drift = (float)(int32_t)(best->offset - peer.anchorOffset) * 1e6f / (float)(best->time - peer.anchorTime);
+        estimate.drift = estimate.driftValid ? estimate.drift + (drift - estimate.drift) / 4 : drift;
+        estimate.driftValid = true;
+        peer.anchorTime = best->time;
+        peer.anchorOffset = best->offset;
+    }
+    estimate.offset = (int32_t)best->offset;
+    estimate.offsetTime = best->time;
+}
+
+uint32_t StarDustTiming::offsetAt(const Peer& peer, uint32_t localTime) {
+    const Estimate& estimate = peer.estimate;
+    if (!estimate.driftValid) return (uint32_t)estimate.offset;
+    const float elapsed = (float)(int32_t)(localTime - estimate.offsetTime);
+    return (uint32_t)estimate.offset + (uint32_t)(int32_t)(estimate.drift * 1e-6f * elapsed);
+}
+
+const StarDustTiming::Estimate* StarDustTiming::estimate(uint8_t id) const {
+    const Peer* peer = findPeer(id);
+    return (peer != nullptr && peer->estimate.samples > 0) ? &peer->estimate : nullptr;
+}
+
+uint32_t StarDustTiming::timeout(uint8_t id) const {
+    const Peer* peer = findPeer(id);
+    return (peer != nullptr && peer->estimate.samples > 0) ? peer->estimate.timeout : 0;
+}
+
+uint32_t StarDustTiming::toPeerTime(uint8_t id, uint32_t localTime) const {
+    const Peer* peer = findPeer(id);
+    if (peer == nullptr || peer->estimate.samples == 0) return localTime;
+    return localTime + offsetAt(*peer, localTime);
+}
+
+uint32_t StarDustTiming::toLocalTime(uint8_t id, uint32_t peerTime) const {
+    const Peer* peer = findPeer(id);
+    if (peer == nullptr || peer->estimate.samples == 0) return peerTime;
+    // Kayma düzeltmesi için yaklaşık yerel zaman yeterlidir // An approximate local time is enough for the drift correction
+    return peerTime - offsetAt(*peer, peerTime - (uint32_t)peer->estimate.offset);
+}
+
+uint32_t StarDustTiming::peerTimeout(uint8_t source, void* context) {
+    return static_cast<const StarDustTiming*>(context)->timeout(source);
+}
+#endif
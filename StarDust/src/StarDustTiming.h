@@ -0,0 +1,169 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Link Timing
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Round trip and clock offset measurement over the heartbeat path. A PING heartbeat carries
+the sender's send time; the peer answers at once with an ECHO holding that time, its own
+receive time and its own send time. From the four timestamps the sender gets the round trip
+without the peer's processing time and an NTP-style clock offset. Per peer it keeps the
+minimum, smoothed mean and mean deviation of the round trip, and the offset of the sample
+with the shortest round trip among the last few (the one least bent by queueing). The drift
+between the two clocks is the slope of that offset over time. The round trip estimate also
+sets the frame timeout of each peer on the link. Plain heartbeats still reach the
+application. All state is static.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_TIMING_H
+#define STARDUST_TIMING_H
+
+#include "StarDust.h"
+
+// Ölçülen eş sayısı // Number of peers measured
+#ifndef STARDUST_TIMING_PEERS
+    #if defined(__AVR__)
+        #define STARDUST_TIMING_PEERS 2
+    #else
+        #define STARDUST_TIMING_PEERS 8
+    #endif
+#endif
+
+// Saat süzgecinin penceresi: kapsanan son örnekler // Window of the clock filter: last samples considered
+#ifndef STARDUST_TIMING_SAMPLES
+    #if defined(__AVR__)
+        #define STARDUST_TIMING_SAMPLES 4
+    #else
+        #define STARDUST_TIMING_SAMPLES 8
+    #endif
+#endif
+
+// Zaman damgası saati (mikrosaniye, 32 bit döner) // Timestamp clock (microseconds, wraps at 32 bits)
+#ifndef STARDUST_TIMING_CLOCK
+    #define STARDUST_TIMING_CLOCK() micros()
+#endif
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_SYSTEMHEARTBEAT)
+class StarDustTiming {
+public:
+    struct Estimate {
+        uint32_t rttMin;      // µs, eşin işleme süresi hariç // µs, without the processing time of the peer
+        uint32_t rttMean;     // Düzgünleştirilmiş (1/8) // Smoothed (1/8)
+        uint32_t rttJitter;   // Ortalama sapma (1/4) // Mean deviation (1/4)
+        int32_t offset;       // Eşin saati - yerel saat, offsetTime anında (µs) // Peer clock - local clock at offsetTime (µs)
+        uint32_t offsetTime;  // Yerel saat // Local clock
+        float drift;          // ppm, eşin saati bu kadar hızlı // ppm, the peer clock runs this much faster
+        bool driftValid;      // En az bir ölçüm aralığı geçti // At least one measuring span has passed
+        uint32_t timeout;     // ms, bu eşin çerçeve zaman aşımı // ms, frame timeout of this peer
+        uint32_t samples;
+        uint32_t lost;        // Yanıtsız kalan yoklamalar // Pings left without an echo
+    };
+
+    typedef void (*HeartbeatHandler)(const SystemHeartbeatPayload& payload, const PacketHeader& header, void* context);
+    typedef uint32_t (*Clock)();
+
+    StarDustTiming();
+
+    // SYSTEMHEARTBEAT işleyicisini ve bağlantının setPeerTimeout() kancasını kullanır; bize adreslenen PING'lere yanıt verir
+    // Uses the SYSTEMHEARTBEAT handler and the setPeerTimeout() hook of the link; answers PINGs addressed to us
+    void begin(StarDustCore& link);
+    // Yoklama ve ECHO dışındaki heartbeat'ler buraya gider // Heartbeats other than the probes go here
+    void onHeartbeat(HeartbeatHandler handler, void* context = nullptr);
+
+    bool addPeer(uint8_t id);         // BROADCAST_ID reddedilir // BROADCAST_ID is refused
+    bool removePeer(uint8_t id);
+    void setInterval(uint16_t ms);    // Eş başına yoklama aralığı (0 = yalnızca ping()) // Ping interval per peer (0 = ping() only)
+    bool ping(uint8_t id);
+    // Eş başına zaman aşımı: ortalama + 4 x sapma, bu sınırlar içinde // Per-peer timeout: mean + 4 x deviation, within these bounds
+    void setTimeoutBounds(uint16_t minMs, uint16_t maxMs);
+    // Başka bir mikrosaniye saati (ör. RTC'ye bağlı) // Another microsecond clock (e.g. tied to an RTC)
+    void setClock(Clock clock);
+
+    // link.dispatch() ve vadesi gelen yoklama; ana döngüden çağrılmalıdır
+    // link.dispatch() and the ping that is due; call it from the main loop
+    uint8_t update();
+
+    const Estimate* estimate(uint8_t id) const;       // nullptr: tabloda yok veya ölçülmedi // nullptr: not in the table or not measured
+    uint32_t timeout(uint8_t id) const;               // ms (0 = ölçülmedi) // ms (0 = not measured)
+    // Kaymayla birlikte saat çevirisi (ör. slave telemetri zaman damgalarını master saatine almak için)
+    // Clock conversion including drift (e.g. to bring slave telemetry timestamps onto the master clock)
+    uint32_t toPeerTime(uint8_t id, uint32_t localTime) const;
+    uint32_t toLocalTime(uint8_t id, uint32_t peerTime) const;
+
+private:
+    struct Sample {
+        uint32_t time;        // Yerel saat // Local clock
+        uint32_t offset;
+        uint32_t delay;
+    };
+
+    struct Peer {
+        Estimate estimate;
+        Sample samples[STARDUST_TIMING_SAMPLES];
+        uint32_t sentAt;      // Açık yoklamanın origin'i // Origin of the open ping
+        uint32_t lastPing;
+        uint32_t anchorTime;  // Kayma ölçümünün başladığı nokta // Point where the drift measurement started
+        uint32_t anchorOffset;
+        uint8_t id;
+        uint8_t seq;
+        uint8_t nextSample;
+        uint8_t sampleCount;
+        bool waiting;
+        bool anchored;
+        bool used;
+    };
+
+    StarDustCore* _link;
+    HeartbeatHandler _heartbeat;
+    void* _heartbeatContext;
+    Clock _clock;
+    uint32_t _interval;       // µs
+    uint32_t _minTimeout;     // ms
+    uint32_t _maxTimeout;
+    uint8_t _nextPeer;        // Yoklama sırası // Ping rotation
+    Peer _peers[STARDUST_TIMING_PEERS];
+
+    Peer* findPeer(uint8_t id);
+    const Peer* findPeer(uint8_t id) const;
+    uint32_t now() const;
+    bool sendProbe(uint8_t target, const HeartbeatSyncPayload& probe);
+    void sample(Peer& peer, const HeartbeatSyncPayload& echo, uint32_t arrival);
+    static uint32_t offsetAt(const Peer& peer, uint32_t localTime);
+
+    static void onFrame(const HeartbeatSyncPayload& payload, const PacketHeader& header, void* context);
+    static uint32_t peerTimeout(uint8_t source, void* context);
+    static uint32_t defaultClock();
+};
+#endif
+
+#endif
@@ -0,0 +1,295 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Bulk Transfer
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+*/
+
+#include "StarDustTransfer.h"
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+static constexpr uint8_t BEGIN_SIZE = 7; // kind, id, tag, size (4)
+static constexpr uint8_t END_SIZE = 6;   // kind, id, crc (4)
+
+StarDustTransfer::StarDustTransfer() {
+    _reliable = nullptr;
+    _message = nullptr;
+    _messageContext = nullptr;
+    _sent = nullptr;
+    _sentContext = nullptr;
+    _chunk = nullptr;
+    _chunkContext = nullptr;
+    _complete = nullptr;
+    _completeContext = nullptr;
+    _buffer = nullptr;
+    _capacity = 0;
+    _timeout = 5000;
+    _nextId = 0;
+    memset(&_out, 0, sizeof(_out));
+    memset(&_in, 0, sizeof(_in));
+}
+
+void StarDustTransfer::begin(StarDustReliable& reliable) {
+    _reliable = &reliable;
+    reliable.onReceive(&StarDustTransfer::onReliable, this);
+}
+
+void StarDustTransfer::onMessage(StarDustReliable::ReceiveHandler handler, void* context) {
+    _message = handler;
+    _messageContext = context;
+}
+
+void StarDustTransfer::onSent(SentHandler handler, void* context) {
+    _sent = handler;
+    _sentContext = context;
+}
+
+void StarDustTransfer::receiveInto(uint8_t* buffer, uint32_t capacity) {
+    _buffer = buffer;
+    _capacity = capacity;
+}
+
+void StarDustTransfer::onChunk(ChunkHandler handler, void* context) {
+    _chunk = handler;
+    _chunkContext = context;
+}
+
+void StarDustTransfer::onComplete(CompleteHandler handler, void* context) {
+    _complete = handler;
+    _completeContext = context;
+}
+
+void StarDustTransfer::setTimeout(uint32_t ms) {
+    _timeout = ms;
+}
+
+// ======================== GÖNDEREN ========================
+// ======================== SENDER ==========================
+bool StarDustTransfer::send(uint8_t target, const void* data, uint32_t size, uint8_t tag) {
+    if (!start(target, size, tag)) return false;
+    _out.data = (const uint8_t*)data;
+    pump();
+    return true;
+}
+
+bool StarDustTransfer::send(uint8_t target, uint32_t size, SourceHandler source, void* context, uint8_t tag) {
+    if (source == nullptr || !start(target, size, tag)) return false;
+    _out.source = source;
+    _out.sourceContext = context;
+    pump();
+    return true;
+}
+
+bool StarDustTransfer::start(uint8_t target, uint32_t size, uint8_t tag) {
+    if (_reliable == nullptr || _out.active || target == BROADCAST_ID) return false;
+    memset(&_out, 0, sizeof(_out));
+    _out.active = true;
+    _out.stage = STAGE_BEGIN;
+    _out.target = target;
+    _out.id = _nextId++;
+    _out.tag = tag;
+    _out.size = size;
+    _out.crc = StarDustCRC32::INIT;
+    _out.failures = _reliable->failures(target);
+    _out.lastActivity = millis();
+    return true;
+}
+
+void StarDustTransfer::cancel() {
+    if (!_out.active) return;
+    sendControl(_out.target, ABORT, _out.id, ABORTED);
+    finishOutgoing(ABORTED);
+}
+
+void StarDustTransfer::pump() {
+    if (!_out.active) return;
+    if (_reliable->failures(_out.target) != _out.failures) {
+        // Pencere atıldı, alıcıdaki nesne eksik kalacak // The window was dropped, the object at the receiver will be incomplete
+        sendControl(_out.target, ABORT, _out.id, LINK_FAILED);
+        finishOutgoing(LINK_FAILED);
+        return;
+    }
+
+    // Pencere doluncaya kadar parça üretilir: hat, onay beklemeden dolu kalır
+    // Fragments are produced until the window is full: the line stays busy without waiting for acks
+    uint8_t frame[StarDustReliable::MAX_DATA];
+    while (_out.stage != STAGE_WAIT && _reliable->inFlight(_out.target) < STARDUST_RELIABLE_WINDOW) {
+        frame[1] = _out.id;
+        uint8_t size = 0;
+        if (_out.stage == STAGE_BEGIN) {
+            frame[0] = BEGIN;
+            frame[2] = _out.tag;
+            memcpy(&frame[3], &_out.size, sizeof(_out.size));
+            size = BEGIN_SIZE;
+        } else if (_out.stage == STAGE_DATA) {
+            const uint32_t remaining = _out.size - _out.offset;
+            const uint8_t length = (remaining < CHUNK_SIZE) ? (uint8_t)remaining : CHUNK_SIZE;
+            frame[0] = CHUNK;
+            if (_out.data != nullptr) {
+                memcpy(&frame[2], _out.data + _out.offset, length);
+            } else if (_out.source(_out.offset, &frame[2], length, _out.sourceContext) != length) {
+                cancel(); // Kaynak beklenenden erken bitti // The source ended earlier than announced
+                return;
+            }
+            size = length + 2;
+        } else {
+            frame[0] = END;
+            const uint32_t crc = StarDustCRC32::finish(_out.crc);
+            memcpy(&frame[2], &crc, sizeof(crc));
+            size = END_SIZE;
+        }
+
+        if (!_reliable->send(_out.target, TRANSFER, frame, size)) {
+            // Pencere boşken reddedildiyse eş tablosu doludur // Refused with an empty window: the peer table is full
+            if (_reliable->inFlight(_out.target) == 0) finishOutgoing(LINK_FAILED);
+            return;
+        }
+
+        if (_out.stage == STAGE_BEGIN) {
+            _out.stage = (_out.size > 0) ? STAGE_DATA : STAGE_END;
+        } else if (_out.stage == STAGE_DATA) {
+            _out.crc = StarDustCRC32::update(_out.crc, &frame[2], size - 2);
+            _out.offset += size - 2;
+            if (_out.offset == _out.size) _out.stage = STAGE_END;
+        } else {
+            _out.stage = STAGE_WAIT;
+        }
+    }
+}
+
+void StarDustTransfer::finishOutgoing(Status status) {
+    _out.active = false;
+    if (_sent != nullptr) _sent(_out.target, _out.tag, status, _sentContext);
+}
+
+bool StarDustTransfer::sendControl(uint8_t target, uint8_t kind, uint8_t id, uint8_t status) {
+    const uint8_t frame[3] = {kind, id, status};
+    return _reliable->send(target, TRANSFER, frame, sizeof(frame));
+}
+
+// ======================== ALICI ========================
+// ======================== RECEIVER ======================
+void StarDustTransfer::onReliable(uint8_t source, PacketType type, const uint8_t* data, uint8_t size, void* context) {
+    StarDustTransfer* self = (StarDustTransfer*)context;
+    if (type == TRANSFER) {
+        self->handle(source, data, size);
+    } else if (self->_message != nullptr) {
+        self->_message(source, type, data, size, self->_messageContext);
+    }
+}
+
+void StarDustTransfer::handle(uint8_t source, const uint8_t* data, uint8_t size) {
+    if (size < 2) return;
+    const uint8_t id = data[1];
+    const bool current = _in.active && _in.source == source && _in.id == id;
+
+    switch (data[0]) {
+        case BEGIN: {
+            if (size < BEGIN_SIZE) return;
+            if (_in.active && _in.source != source) {
+                sendControl(source, DONE, id, BUSY);
+                return;
+            }
+            if (_in.active) finishIncoming(ABORTED); // Gönderen yeniden başladı // The sender started over
+
+            uint32_t total;
+            memcpy(&total, &data[3], sizeof(total));
+            if ((_buffer != nullptr) ? total > _capacity : _chunk == nullptr) {
+                sendControl(source, DONE, id, TOO_LARGE);
+                return;
+            }
+            _in.active = true;
+            _in.source = source;
+            _in.id = id;
+            _in.tag = data[2];
+            _in.size = total;
+            _in.offset = 0;
+            _in.crc = StarDustCRC32::INIT;
+            _in.lastActivity = millis();
+            break;
+        }
+
+        case CHUNK: {
+            if (!current) return; // Reddedilmiş veya bitmiş aktarımın kalanları // Leftovers of a refused or finished transfer
+            const uint8_t length = size - 2;
+            if (_in.offset + length > _in.size) {
+                sendControl(source, DONE, id, CRC_MISMATCH);
+                finishIncoming(CRC_MISMATCH);
+                return;
+            }
+            if (_buffer != nullptr) memcpy(_buffer + _in.offset, &data[2], length);
+            if (_chunk != nullptr) _chunk(source, _in.tag, _in.offset, &data[2], length, _chunkContext);
+            _in.crc = StarDustCRC32::update(_in.crc, &data[2], length);
+            _in.offset += length;
+            _in.lastActivity = millis();
+            break;
+        }
+
+        case END: {
+            if (!current || size < END_SIZE) return;
+            uint32_t crc;
+            memcpy(&crc, &data[2], sizeof(crc));
+            const Status status = (_in.offset == _in.size && StarDustCRC32::finish(_in.crc) == crc) ? COMPLETE : CRC_MISMATCH;
+            sendControl(source, DONE, id, status);
+            finishIncoming(status);
+            break;
+        }
+
+        case DONE:
+            if (size >= 3 && _out.active && _out.target == source && _out.id == id) finishOutgoing((Status)data[2]);
+            break;
+
+        case ABORT:
+            if (current) finishIncoming(ABORTED);
+            break;
+    }
+}
+
+void StarDustTransfer::finishIncoming(Status status) {
+    _in.active = false;
+    if (_complete != nullptr) _complete(_in.source, _in.tag, _buffer, _in.offset, status, _completeContext);
+}
+
+// ======================== DÖNGÜ ========================
+// ======================== LOOP ==========================
+uint8_t StarDustTransfer::update() {
+    if (_reliable == nullptr) return 0;
+    const uint8_t handled = _reliable->update();
+    pump();
+
+    const uint32_t now = millis();
+    if (_in.active && now - _in.lastActivity > _timeout) finishIncoming(ABORTED);
+    if (_out.active) {
+        // Son parça onaylandıktan sonra DONE beklenir // DONE is awaited once the last fragment is acknowledged
+        if (_out.stage != STAGE_WAIT || _reliable->inFlight(_out.target) > 0) {
+            _out.lastActivity = now;
+        } else if (now - _out.lastActivity > _timeout) {
+            finishOutgoing(ABORTED);
+        }
+    }
+    return handled;
+}
+#endif
@@ -0,0 +1,162 @@
+/*
+
+MIT License
+
+Copyright (c) 2026 Metehan Semerci
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+StarDust Bulk Transfer
+Author: Metehan Semerci
+Contact: furkanmetehansemerci@gmail.com
+
+
+Transfers objects of any length (configuration blobs, waypoint lists, firmware images)
+over a StarDustReliable channel. The object is cut into fragments that fill the
+reliable window back to back, so the line stays busy instead of waiting per chunk.
+The sender reads from a buffer or a source callback, the receiver writes into a
+caller-provided buffer and/or a chunk callback: RAM use does not depend on the object
+size. A CRC32 over the whole object is checked at the end and reported to both sides.
+
+*/
+
+
+
+
+
+
+
+#ifndef STARDUST_TRANSFER_H
+#define STARDUST_TRANSFER_H
+
+#include "StarDustReliable.h"
+
+#if STARDUST_HAS_TYPE(STARDUST_TYPE_RELIABLE | STARDUST_TYPE_RELIABLEACK)
+class StarDustTransfer {
+public:
+    static constexpr uint8_t CHUNK_SIZE = StarDustReliable::MAX_DATA - 2; // Parça başına veri // Data per fragment
+
+    enum Status : uint8_t {
+        COMPLETE = 0,     // CRC doğrulandı // CRC verified
+        CRC_MISMATCH = 1,
+        TOO_LARGE = 2,    // Alıcı tamponuna sığmıyor // Does not fit into the receive buffer
+        BUSY = 3,         // Alıcı başka bir eşten alıyor // Receiver is busy with another peer
+        ABORTED = 4,      // İptal veya zaman aşımı // Cancelled or timed out
+        LINK_FAILED = 5   // Güvenilir kanal vazgeçti // The reliable channel gave up
+    };
+
+    // Gönderen veri kaynağı: offset'ten başlayarak en çok max byte yazar, yazılan sayıyı döndürür
+    // Sender data source: writes at most max bytes starting at offset, returns the number written
+    typedef uint8_t (*SourceHandler)(uint32_t offset, uint8_t* out, uint8_t max, void* context);
+    typedef void (*SentHandler)(uint8_t target, uint8_t tag, Status status, void* context);
+    // Alıcı: parçalar sırayla gelir // Receiver: chunks arrive in order
+    typedef void (*ChunkHandler)(uint8_t source, uint8_t tag, uint32_t offset, const uint8_t* data, uint8_t size, void* context);
+    // data: receiveInto() tamponu (yoksa nullptr) // data: the receiveInto() buffer (nullptr if none)
+    typedef void (*CompleteHandler)(uint8_t source, uint8_t tag, const uint8_t* data, uint32_t size, Status status, void* context);
+
+    StarDustTransfer();
+
+    // Güvenilir kanalın alım işleyicisini devralır; diğer mesajlar onMessage() ile iletilir
+    // Takes over the receive handler of the reliable channel; other messages are passed on through onMessage()
+    void begin(StarDustReliable& reliable);
+    void onMessage(StarDustReliable::ReceiveHandler handler, void* context = nullptr);
+
+    // ==== GÖNDEREN ==== // ==== SENDER ====
+    // Aynı anda tek gönderim; tampon aktarım bitene kadar geçerli kalmalıdır (kopyalanmaz)
+    // One transfer at a time; the buffer must stay valid until the transfer ends (it is not copied)
+    bool send(uint8_t target, const void* data, uint32_t size, uint8_t tag = 0);
+    bool send(uint8_t target, uint32_t size, SourceHandler source, void* context, uint8_t tag = 0);
+    void onSent(SentHandler handler, void* context = nullptr);
+    void cancel();
+    bool sending() const { return _out.active; }
+    uint32_t sentBytes() const { return _out.offset; }
+
+    // ==== ALICI ==== // ==== RECEIVER ====
+    void receiveInto(uint8_t* buffer, uint32_t capacity);
+    void onChunk(ChunkHandler handler, void* context = nullptr);
+    void onComplete(CompleteHandler handler, void* context = nullptr);
+    void setTimeout(uint32_t ms);  // Alıcı tarafında sessizlik sınırı // Silence limit on the receiving side
+    bool receiving() const { return _in.active; }
+    uint32_t receivedBytes() const { return _in.offset; }
+
+    // reliable.update() ve parça üretimi; ana döngüden çağrılmalıdır
+    // reliable.update() and fragment production; call it from the main loop
+    uint8_t update();
+
+private:
+    // Parça türleri (mesajın ilk byte'ı) // Fragment kinds (first byte of the message)
+    enum Kind : uint8_t { BEGIN = 0, CHUNK = 1, END = 2, DONE = 3, ABORT = 4 };
+    enum Stage : uint8_t { STAGE_BEGIN, STAGE_DATA, STAGE_END, STAGE_WAIT };
+
+    struct Outgoing {
+        bool active;
+        uint8_t stage;
+        uint8_t target;
+        uint8_t id;
+        uint8_t tag;
+        uint8_t failures;    // Başlangıçtaki reliable.failures() // reliable.failures() at the start
+        uint32_t size;
+        uint32_t offset;
+        uint32_t crc;
+        uint32_t lastActivity;
+        const uint8_t* data;
+        SourceHandler source;
+        void* sourceContext;
+    };
+
+    struct Incoming {
+        bool active;
+        uint8_t source;
+        uint8_t id;
+        uint8_t tag;
+        uint32_t size;
+        uint32_t offset;
+        uint32_t crc;
+        uint32_t lastActivity;
+    };
+
+    StarDustReliable* _reliable;
+    StarDustReliable::ReceiveHandler _message;
+    void* _messageContext;
+    SentHandler _sent;
+    void* _sentContext;
+    ChunkHandler _chunk;
+    void* _chunkContext;
+    CompleteHandler _complete;
+    void* _completeContext;
+    uint8_t* _buffer;
+    uint32_t _capacity;
+    uint32_t _timeout;
+    uint8_t _nextId;
+    Outgoing _out;
+    Incoming _in;
+
+    bool start(uint8_t target, uint32_t size, uint8_t tag);
+    void pump();
+    void finishOutgoing(Status status);
+    void finishIncoming(Status status);
+    bool sendControl(uint8_t target, uint8_t kind, uint8_t id, uint8_t status);
+    void handle(uint8_t source, const uint8_t* data, uint8_t size);
+
+    static void onReliable(uint8_t source, PacketType type, const uint8_t* data, uint8_t size, void* context);
+};
+
+#endif
+
+#endif